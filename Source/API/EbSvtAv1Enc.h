@@ -595,9 +595,11 @@ typedef struct EbSvtAv1EncConfiguration {
     *  Default is -1. */
     int enable_mfmv;
 
-    /* Flag to enable the scene change detection algorithm.
+    /* Flag to enable the scene change detection algorithm. A key frame is inserted at
+     * each detected scene change for closed-GOP (SVT_AV1_KF_REFRESH) random access
+     * CRF/CQP encodes; other configurations ignore it.
      *
-     * Default is 1. */
+     * Default is 0. */
     uint32_t scene_change_detection;
 
     /* Log 2 Tile Rows and columns . 0 means no tiling,1 means that we split the dimension
@@ -1219,6 +1221,7 @@ EB_API EbErrorType svt_av1_enc_stream_header(EbComponentType*     svt_enc_compon
 EB_API EbErrorType svt_av1_enc_stream_header_release(EbBufferHeaderType* stream_header_ptr);
 
 /* STEP 4: Send the picture.
+     * Returns EB_ErrorMax once the encoder stopped on an error, which svt_av1_enc_get_packet() also reports.
      *
      * Parameter:
      * @ *svt_enc_component  Encoder handler.
@@ -1238,6 +1241,83 @@ EB_API EbErrorType svt_av1_enc_send_picture(EbComponentType* svt_enc_component,
 EB_API EbErrorType svt_av1_enc_get_packet(EbComponentType* svt_enc_component, EbBufferHeaderType** p_buffer,
                                           uint8_t pic_send_done);
 
+/**
+ * @brief Packet ready callback function signature
+ *
+ * Called from an encoder thread each time a packet (including the EOS and error packets) has been queued and can be
+ * retrieved with svt_av1_enc_get_packet(). The callback only signals availability: it should return quickly and must
+ * not block, for example by writing to an eventfd or waking an event loop that then drains the packets.
+ *
+ * @param[in] context Opaque user-provided context pointer given at registration
+ */
+typedef void (*SvtAv1PacketReadyCallback)(void* context);
+
+/* OPTIONAL: Register a callback fired each time an output packet becomes available.
+     * This removes the need for a thread polling svt_av1_enc_get_packet(). Must be called before
+     * svt_av1_enc_init().
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ callback            Callback function pointer, NULL to unregister.
+     * @ *context            Opaque context pointer passed back to the callback. */
+EB_API EbErrorType svt_av1_enc_set_packet_ready_callback(EbComponentType*          svt_enc_component,
+                                                         SvtAv1PacketReadyCallback callback, void* context);
+
+/**
+ * @brief Output packet payload allocator
+ *
+ * Lets the application own the memory the encoder writes OBUs into, so packets can be muxed without a copy. The
+ * encoder calls alloc when it needs a payload buffer for a packet (and again with a larger size if a temporal unit
+ * grows past the initial estimate), and free when the payload is released through svt_av1_enc_release_out_buffer()
+ * or discarded internally. Both callbacks may be invoked from encoder threads and must be thread-safe.
+ */
+typedef struct SvtAv1PacketAllocator {
+    /* Return a buffer of at least size bytes, or NULL on failure. On failure the picture is dropped and
+     * svt_av1_enc_get_packet() returns an error for the packets that would have carried it. */
+    void* (*alloc)(void* context, size_t size);
+    /* Release a buffer previously returned by alloc. */
+    void (*free)(void* context, void* buffer);
+    /* Opaque pointer passed back to both callbacks. */
+    void* context;
+} SvtAv1PacketAllocator;
+
+/* OPTIONAL: Register an allocator for output packet payloads. Must be called before svt_av1_enc_init().
+     * When no allocator is registered the encoder allocates payloads from the heap.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *allocator          Allocator callbacks, copied by the encoder. NULL restores the default allocator. */
+EB_API EbErrorType svt_av1_enc_set_packet_allocator(EbComponentType*             svt_enc_component,
+                                                    const SvtAv1PacketAllocator* allocator);
+
+/**
+ * @brief Rate targets for svt_av1_enc_update_rate_info()
+ *
+ * A field set to 0 keeps its current value.
+ */
+typedef struct SvtAv1RateUpdate {
+    /* Sequence QP, with --rc 0. */
+    uint32_t seq_qp;
+    /* Target bit rate in bits per second, with CBR. */
+    uint32_t target_bit_rate;
+    /* Maximum bit rate in bits per second, with capped CRF. */
+    uint32_t max_bit_rate;
+} SvtAv1RateUpdate;
+
+/* OPTIONAL: Change the rate targets of the stream being encoded, e.g. to follow the network
+     * bandwidth. The change is queued and applies without flushing the pictures in flight: the
+     * sequence QP and max bit rate from the next picture the encoder takes in, as with a
+     * RATE_CHANGE_EVENT, the target bit rate from the next mini-GOP it sets up. Can be called from
+     * any thread once svt_av1_enc_init() has returned, but not concurrently with svt_av1_enc_reset()
+     * or svt_av1_enc_deinit().
+     * Requests made before they are applied are merged, the latest value of a field wins.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *rate_info          New targets. */
+EB_API EbErrorType svt_av1_enc_update_rate_info(EbComponentType*        svt_enc_component,
+                                                const SvtAv1RateUpdate* rate_info);
+
 /* STEP 5-1: Release output buffer back into the pool.
      *
      * Parameter:
@@ -1259,6 +1339,21 @@ EB_API EbErrorType svt_av1_get_recon(EbComponentType* svt_enc_component, EbBuffe
      * @ *info         output, the type depends on id */
 EB_API EbErrorType svt_av1_enc_get_stream_info(EbComponentType* svt_enc_component, uint32_t stream_info_id, void* info);
 
+/* OPTIONAL: Start a new stream on an initialized encoder, instead of STEP 6 and 7 followed by STEP 1 to 3.
+     * The current stream is finished first: EOS is sent if the application did not, and the packets it did
+     * not retrieve are discarded. All the output packets must have been released: otherwise
+     * EB_ErrorBadParameter is returned once the stream is finished, and the reset can be retried after
+     * releasing them. The threads, the pools and their pictures are reused when the new configuration
+     * keeps what they were built for: resolution, bit depth, color format, preset, prediction structure,
+     * parallelism and the tools that size the pictures. Otherwise the encoder is rebuilt within the same
+     * handle. Registered callbacks and allocators are kept.
+     *
+     * Parameter:
+     * @ *svt_enc_component  Encoder handler.
+     * @ *config_struct      Configuration of the next stream, as for svt_av1_enc_set_parameter(). An
+     *                       invalid configuration returns an error and leaves the current stream untouched. */
+EB_API EbErrorType svt_av1_enc_reset(EbComponentType* svt_enc_component, EbSvtAv1EncConfiguration* config_struct);
+
 /* STEP 6: Deinitialize encoder library.
      *
      * Parameter:
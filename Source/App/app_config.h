@@ -75,6 +75,8 @@ typedef struct EbPerformanceContext {
 
     double total_execution_time; // includes init
     double total_encode_time; // not including init
+    double init_time; // svt_av1_enc_init() and the other setup before the first frame is sent
+    double first_packet_time; // from library start to the first packet, includes init
 
     uint64_t total_latency;
     uint32_t max_latency;
@@ -311,11 +311,13 @@ static void print_performance(const EncContext* const enc_context) {
                  app_cfg->config.pass == 3)) {
                 fprintf(stderr,
                         "\nAverage Speed:\t\t%.3f fps\nTotal Encoding Time:\t%.0f "
-                        "ms\nTotal Execution Time:\t%.0f ms\nAverage Latency:\t%.0f ms\nMax "
-                        "Latency:\t\t%u ms\n",
+                        "ms\nTotal Execution Time:\t%.0f ms\nInit Time:\t\t%.1f ms\nFirst Packet Time:\t%.0f "
+                        "ms\nAverage Latency:\t%.0f ms\nMax Latency:\t\t%u ms\n",
                         app_cfg->performance_context.average_speed,
                         app_cfg->performance_context.total_encode_time * 1000,
                         app_cfg->performance_context.total_execution_time * 1000,
+                        app_cfg->performance_context.init_time * 1000,
+                        app_cfg->performance_context.first_packet_time * 1000,
                         app_cfg->performance_context.average_latency,
                         (uint32_t)(app_cfg->performance_context.max_latency));
             }
@@ -399,6 +401,11 @@ static void enc_channel_start(EncChannel* c) {
         c->active           = true;
         app_svt_av1_get_time(&app_cfg->performance_context.encode_start_time[0],
                              &app_cfg->performance_context.encode_start_time[1]);
+        app_cfg->performance_context.init_time = app_svt_av1_compute_overall_elapsed_time(
+            app_cfg->performance_context.lib_start_time[0],
+            app_cfg->performance_context.lib_start_time[1],
+            app_cfg->performance_context.encode_start_time[0],
+            app_cfg->performance_context.encode_start_time[1]);
     }
 }
 
@@ -1057,6 +1057,9 @@ void process_output_stream_buffer(EncChannel* channel, EncApp* enc_app, int32_t*
                     app_cfg->performance_context.lib_start_time[1],
                     finish_s_time,
                     finish_u_time);
+                if (app_cfg->performance_context.frame_count == 1 && !(flags & EB_BUFFERFLAG_IS_ALT_REF)) {
+                    app_cfg->performance_context.first_packet_time = app_cfg->performance_context.total_execution_time;
+                }
 
                 // total encode time
                 app_cfg->performance_context.total_encode_time = app_svt_av1_compute_overall_elapsed_time(
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#else
+#include <arm_acle.h>
+#endif
+#include <string.h>
+
+#include "definitions.h"
+
+// CRC-32C using the Armv8 CRC32 instructions, bit-exact with svt_av1_get_crc32c_value_c()
+uint32_t svt_av1_get_crc32c_value_arm_crc32(void* crc_calculator, const uint8_t* p, size_t length) {
+    (void)crc_calculator;
+    const uint8_t* buf = p;
+    uint32_t       crc = 0xFFFFFFFF;
+
+    // Align the input to the word boundary
+    for (; length > 0 && ((uintptr_t)buf & 7); buf++, length--) {
+        crc = __crc32cb(crc, *buf);
+    }
+    for (; length >= 8; buf += 8, length -= 8) {
+        uint64_t v;
+        memcpy(&v, buf, sizeof(v));
+        crc = __crc32cd(crc, v);
+    }
+    if (length >= 4) {
+        uint32_t v;
+        memcpy(&v, buf, sizeof(v));
+        crc = __crc32cw(crc, v);
+        buf += 4;
+        length -= 4;
+    }
+    if (length >= 2) {
+        uint16_t v;
+        memcpy(&v, buf, sizeof(v));
+        crc = __crc32ch(crc, v);
+        buf += 2;
+        length -= 2;
+    }
+    if (length) {
+        crc = __crc32cb(crc, *buf);
+    }
+    return crc ^ 0xFFFFFFFF;
+}
@@ -12,6 +12,7 @@
 #include <immintrin.h>
 #include "definitions.h"
 #include "memory_avx2.h"
+#include "aom_dsp_rtcd.h"
 #include "common_dsp_rtcd.h"
 #include "inter_prediction.h"
 #include "resize.h"
@@ -2827,3 +2828,88 @@ EbErrorType svt_av1_resize_plane_avx2(const uint8_t* const input, int in_height,
     EB_FREE_ARRAY(intbuf);
     return ret;
 }
+
+// Normative super-resolution upscale. Every output pixel has its own source position and filter phase, so the 8 taps of
+// two pixels are loaded into one register, pixels x + i and x + i + 4 sharing a register so that the horizontal adds
+// leave 8 results in order.
+static INLINE __m256i convolve_horiz_rs_madd_avx2(const __m128i s_lo, const __m128i s_hi, const int16_t* x_filters,
+                                                  int x_qn_lo, int x_qn_hi) {
+    const int16_t* const f_lo = &x_filters[((x_qn_lo & RS_SCALE_SUBPEL_MASK) >> RS_SCALE_EXTRA_BITS) *
+                                           UPSCALE_NORMATIVE_TAPS];
+    const int16_t* const f_hi = &x_filters[((x_qn_hi & RS_SCALE_SUBPEL_MASK) >> RS_SCALE_EXTRA_BITS) *
+                                           UPSCALE_NORMATIVE_TAPS];
+    const __m256i s = _mm256_inserti128_si256(_mm256_castsi128_si256(s_lo), s_hi, 1);
+    const __m256i f = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)f_lo)), _mm_loadu_si128((const __m128i*)f_hi), 1);
+    return _mm256_madd_epi16(s, f);
+}
+
+static INLINE __m256i convolve_horiz_rs_sum_avx2(const __m256i prod[4]) {
+    const __m256i sum = _mm256_hadd_epi32(_mm256_hadd_epi32(prod[0], prod[1]), _mm256_hadd_epi32(prod[2], prod[3]));
+    return _mm256_srai_epi32(_mm256_add_epi32(sum, _mm256_set1_epi32(1 << (FILTER_BITS - 1))), FILTER_BITS);
+}
+
+void svt_av1_convolve_horiz_rs_avx2(const uint8_t* src, int src_stride, uint8_t* dst, int dst_stride, int w, int h,
+                                    const int16_t* x_filters, int x0_qn, int x_step_qn) {
+    const int            w8    = w & ~7;
+    const uint8_t* const src_0 = src - (UPSCALE_NORMATIVE_TAPS / 2 - 1);
+
+    for (int y = 0; y < h; ++y) {
+        const uint8_t* const src_y = src_0 + y * src_stride;
+        uint8_t* const       dst_y = dst + y * dst_stride;
+        int                  x_qn  = x0_qn;
+        for (int x = 0; x < w8; x += 8) {
+            __m256i prod[4];
+            for (int i = 0; i < 4; ++i) {
+                const int     x_qn_lo = x_qn + i * x_step_qn;
+                const int     x_qn_hi = x_qn_lo + 4 * x_step_qn;
+                const __m128i s_lo    = _mm_cvtepu8_epi16(
+                    _mm_loadl_epi64((const __m128i*)&src_y[x_qn_lo >> RS_SCALE_SUBPEL_BITS]));
+                const __m128i s_hi = _mm_cvtepu8_epi16(
+                    _mm_loadl_epi64((const __m128i*)&src_y[x_qn_hi >> RS_SCALE_SUBPEL_BITS]));
+                prod[i] = convolve_horiz_rs_madd_avx2(s_lo, s_hi, x_filters, x_qn_lo, x_qn_hi);
+            }
+            const __m256i sum   = convolve_horiz_rs_sum_avx2(prod);
+            const __m128i sum16 = _mm_packs_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+            _mm_storel_epi64((__m128i*)&dst_y[x], _mm_packus_epi16(sum16, sum16));
+            x_qn += 8 * x_step_qn;
+        }
+    }
+
+    if (w8 < w) {
+        svt_av1_convolve_horiz_rs_c(
+            src, src_stride, dst + w8, dst_stride, w - w8, h, x_filters, x0_qn + w8 * x_step_qn, x_step_qn);
+    }
+}
+
+void svt_av1_highbd_convolve_horiz_rs_avx2(const uint16_t* src, int src_stride, uint16_t* dst, int dst_stride, int w,
+                                           int h, const int16_t* x_filters, int x0_qn, int x_step_qn, int bd) {
+    const int             w8    = w & ~7;
+    const uint16_t* const src_0 = src - (UPSCALE_NORMATIVE_TAPS / 2 - 1);
+    const __m128i         max   = _mm_set1_epi16((1 << bd) - 1);
+
+    for (int y = 0; y < h; ++y) {
+        const uint16_t* const src_y = src_0 + y * src_stride;
+        uint16_t* const       dst_y = dst + y * dst_stride;
+        int                   x_qn  = x0_qn;
+        for (int x = 0; x < w8; x += 8) {
+            __m256i prod[4];
+            for (int i = 0; i < 4; ++i) {
+                const int     x_qn_lo = x_qn + i * x_step_qn;
+                const int     x_qn_hi = x_qn_lo + 4 * x_step_qn;
+                const __m128i s_lo    = _mm_loadu_si128((const __m128i*)&src_y[x_qn_lo >> RS_SCALE_SUBPEL_BITS]);
+                const __m128i s_hi    = _mm_loadu_si128((const __m128i*)&src_y[x_qn_hi >> RS_SCALE_SUBPEL_BITS]);
+                prod[i]               = convolve_horiz_rs_madd_avx2(s_lo, s_hi, x_filters, x_qn_lo, x_qn_hi);
+            }
+            const __m256i sum   = convolve_horiz_rs_sum_avx2(prod);
+            const __m128i sum16 = _mm_packus_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+            _mm_storeu_si128((__m128i*)&dst_y[x], _mm_min_epu16(sum16, max));
+            x_qn += 8 * x_step_qn;
+        }
+    }
+
+    if (w8 < w) {
+        svt_av1_highbd_convolve_horiz_rs_c(
+            src, src_stride, dst + w8, dst_stride, w - w8, h, x_filters, x0_qn + w8 * x_step_qn, x_step_qn, bd);
+    }
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at www.aomedia.org/license/software. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at www.aomedia.org/license/patent.
+ */
+
+#include <arm_neon.h>
+
+#include "aom_dsp_rtcd.h"
+#include "definitions.h"
+#include "mem_neon.h"
+#include "super_res.h"
+
+// Every output pixel has its own source position and filter phase: filter 4 of them with one 8-tap multiply-accumulate
+// each and reduce the partial sums pairwise, leaving the 4 results in order.
+static inline int32x4_t convolve_horiz_rs_madd(const int16x8_t s, const int16_t* x_filters, int x_qn) {
+    const int16x8_t f = vld1q_s16(
+        &x_filters[((x_qn & RS_SCALE_SUBPEL_MASK) >> RS_SCALE_EXTRA_BITS) * UPSCALE_NORMATIVE_TAPS]);
+    const int32x4_t prod = vmull_s16(vget_low_s16(s), vget_low_s16(f));
+    return vmlal_s16(prod, vget_high_s16(s), vget_high_s16(f));
+}
+
+static inline uint16x4_t convolve_horiz_rs_sum(const int32x4_t prod[4]) {
+    const int32x4_t sum = vpaddq_s32(vpaddq_s32(prod[0], prod[1]), vpaddq_s32(prod[2], prod[3]));
+    return vqrshrun_n_s32(sum, FILTER_BITS);
+}
+
+void svt_av1_convolve_horiz_rs_neon(const uint8_t* src, int src_stride, uint8_t* dst, int dst_stride, int w, int h,
+                                    const int16_t* x_filters, int x0_qn, int x_step_qn) {
+    const int            w4    = w & ~3;
+    const uint8_t* const src_0 = src - (UPSCALE_NORMATIVE_TAPS / 2 - 1);
+
+    for (int y = 0; y < h; ++y) {
+        const uint8_t* const src_y = src_0 + y * src_stride;
+        uint8_t* const       dst_y = dst + y * dst_stride;
+        int                  x_qn  = x0_qn;
+        for (int x = 0; x < w4; x += 4) {
+            int32x4_t prod[4];
+            for (int i = 0; i < 4; ++i) {
+                const int16x8_t s = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(&src_y[x_qn >> RS_SCALE_SUBPEL_BITS])));
+                prod[i]           = convolve_horiz_rs_madd(s, x_filters, x_qn);
+                x_qn += x_step_qn;
+            }
+            const uint16x4_t sum = convolve_horiz_rs_sum(prod);
+            store_u8_4x1(&dst_y[x], vqmovn_u16(vcombine_u16(sum, sum)));
+        }
+    }
+
+    if (w4 < w) {
+        svt_av1_convolve_horiz_rs_c(
+            src, src_stride, dst + w4, dst_stride, w - w4, h, x_filters, x0_qn + w4 * x_step_qn, x_step_qn);
+    }
+}
+
+void svt_av1_highbd_convolve_horiz_rs_neon(const uint16_t* src, int src_stride, uint16_t* dst, int dst_stride, int w,
+                                           int h, const int16_t* x_filters, int x0_qn, int x_step_qn, int bd) {
+    const int             w4    = w & ~3;
+    const uint16_t* const src_0 = src - (UPSCALE_NORMATIVE_TAPS / 2 - 1);
+    const uint16x4_t      max   = vdup_n_u16((1 << bd) - 1);
+
+    for (int y = 0; y < h; ++y) {
+        const uint16_t* const src_y = src_0 + y * src_stride;
+        uint16_t* const       dst_y = dst + y * dst_stride;
+        int                   x_qn  = x0_qn;
+        for (int x = 0; x < w4; x += 4) {
+            int32x4_t prod[4];
+            for (int i = 0; i < 4; ++i) {
+                const int16x8_t s = vreinterpretq_s16_u16(vld1q_u16(&src_y[x_qn >> RS_SCALE_SUBPEL_BITS]));
+                prod[i]           = convolve_horiz_rs_madd(s, x_filters, x_qn);
+                x_qn += x_step_qn;
+            }
+            vst1_u16(&dst_y[x], vmin_u16(convolve_horiz_rs_sum(prod), max));
+        }
+    }
+
+    if (w4 < w) {
+        svt_av1_highbd_convolve_horiz_rs_c(
+            src, src_stride, dst + w4, dst_stride, w - w4, h, x_filters, x0_qn + w4 * x_step_qn, x_step_qn, bd);
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the Alliance for Open
+ * Media Patent License 1.0 was not distributed with this source code in the
+ * PATENTS file, you can obtain it at https://www.aomedia.org/license/patent-license.
+ */
+
+#include <nmmintrin.h>
+#include <string.h>
+
+#include "definitions.h"
+
+// CRC-32C using the SSE4.2 crc32 instruction, bit-exact with svt_av1_get_crc32c_value_c()
+uint32_t svt_av1_get_crc32c_value_sse4_2(void* crc_calculator, const uint8_t* p, size_t length) {
+    (void)crc_calculator;
+    const uint8_t* buf = p;
+    uint64_t       crc = 0xFFFFFFFF;
+
+    // Align the input to the word boundary
+    for (; length > 0 && ((uintptr_t)buf & 7); buf++, length--) {
+        crc = _mm_crc32_u8((uint32_t)crc, *buf);
+    }
+    for (; length >= 8; buf += 8, length -= 8) {
+        uint64_t v;
+        memcpy(&v, buf, sizeof(v));
+        crc = _mm_crc32_u64(crc, v);
+    }
+    uint32_t crc32 = (uint32_t)crc;
+    if (length >= 4) {
+        uint32_t v;
+        memcpy(&v, buf, sizeof(v));
+        crc32 = _mm_crc32_u32(crc32, v);
+        buf += 4;
+        length -= 4;
+    }
+    if (length >= 2) {
+        uint16_t v;
+        memcpy(&v, buf, sizeof(v));
+        crc32 = _mm_crc32_u16(crc32, v);
+        buf += 2;
+        length -= 2;
+    }
+    if (length) {
+        crc32 = _mm_crc32_u8(crc32, *buf);
+    }
+    return crc32 ^ 0xFFFFFFFF;
+}
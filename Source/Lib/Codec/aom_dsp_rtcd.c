@@ -67,6 +67,12 @@
 #define SET_FUNCTION_NEOVERSE_V2(ptr, neoverse_v2)
 #endif // HAVE_SVE
 
+#if HAVE_ARM_CRC32
+#define SET_FUNCTION_ARM_CRC32(ptr, arm_crc32) SET_FUNCTION(ptr, arm_crc32, EB_CPU_FLAGS_ARM_CRC32)
+#else
+#define SET_FUNCTION_ARM_CRC32(ptr, arm_crc32)
+#endif // HAVE_ARM_CRC32
+
 #define SET_FUNCTIONS_AARCH64(ptr, neon, neon_dotprod, sve, neoverse_v2) \
     SET_FUNCTION(ptr, neon, EB_CPU_FLAGS_NEON)                           \
     SET_FUNCTION_NEON_DOTPROD(ptr, neon_dotprod)                         \
@@ -164,6 +170,7 @@
 #define SET_SSE41(ptr, c, sse4_1)                                     SET_FUNCTIONS_AVX2(ptr, c, 0, 0, 0, 0, 0, sse4_1, 0, 0, 0, 0)
 #define SET_SSE41_AVX2(ptr, c, sse4_1, avx2)                          SET_FUNCTIONS_AVX2(ptr, c, 0, 0, 0, 0, 0, sse4_1, 0, 0, avx2, 0)
 #define SET_SSE41_AVX2_AVX512(ptr, c, sse4_1, avx2, avx512)           SET_FUNCTIONS_AVX2(ptr, c, 0, 0, 0, 0, 0, sse4_1, 0, 0, avx2, avx512)
+#define SET_SSE42(ptr, c, sse4_2)                                     SET_FUNCTIONS_AVX2(ptr, c, 0, 0, 0, 0, 0, 0, sse4_2, 0, 0, 0)
 #define SET_AVX2(ptr, c, avx2)                                        SET_FUNCTIONS_AVX2(ptr, c, 0, 0, 0, 0, 0, 0, 0, 0, avx2, 0)
 #define SET_AVX2_AVX512(ptr, c, avx2, avx512)                         SET_FUNCTIONS_AVX2(ptr, c, 0, 0, 0, 0, 0, 0, 0, 0, avx2, avx512)
 #define SET_SSE2_AVX2_AVX512(ptr, c, sse2, avx2, avx512)              SET_FUNCTIONS_AVX2(ptr, c, 0, 0, sse2, 0, 0, 0, 0, 0, avx2, avx512)
@@ -173,6 +180,14 @@
 #define SET_NEON_NEON_DOTPROD_SVE_NEOVERSE_V2(ptr, c, neon, neon_dotprod, sve, neoverse_v2)    SET_FUNCTIONS_NEON(ptr, c, neon, neon_dotprod, sve, neoverse_v2)
 #define SET_NEON_NEON_DOTPROD_SVE(ptr, c, neon, neon_dotprod, sve)    SET_FUNCTIONS_NEON(ptr, c, neon, neon_dotprod, sve, 0)
 #define SET_NEON_SVE(ptr, c, neon, sve)                               SET_FUNCTIONS_NEON(ptr, c, neon, 0, sve, 0)
+// CRC32 is optional in Armv8.0-A, so the C fallback is always assigned first
+#define SET_ARM_CRC32(ptr, c, arm_crc32)       \
+    do {                                       \
+        CHECK_PTR_IS_NOT_SET(ptr)              \
+        SET_FUNCTION_C(ptr, c)                 \
+        SET_FUNCTION_ARM_CRC32(ptr, arm_crc32) \
+        CHECK_PTR_IS_SET(ptr)                  \
+    } while (0)
 #endif
 
 // Thread-safe RTCD initialization using lazily-initialized mutex
@@ -182,10 +197,6 @@ void svt_aom_setup_rtcd_internal(EbCpuFlags flags) {
     RUN_ONCE_MUTEX(rtcd_init_mutex);
     svt_block_on_mutex(rtcd_init_mutex);
 
-    /* Avoid check that pointer is set double, after first setup. */
-    static bool first_call_setup = true;
-    bool        check_pointer_was_set = first_call_setup;
-    first_call_setup = false;
     /** Should be done during library initialization,
         but for safe limiting cpu flags again. */
 #if defined ARCH_X86_64 || defined ARCH_AARCH64
@@ -194,13 +205,28 @@ void svt_aom_setup_rtcd_internal(EbCpuFlags flags) {
     flags = 0;
     //to use C: flags=0
 #endif
+    /* The table is process-wide: every further encoder instance asking for the same
+       flags finds it already set and skips rewriting it under running instances. */
+    static bool       table_set   = false;
+    static EbCpuFlags table_flags = 0;
+    if (table_set && table_flags == flags) {
+        svt_release_mutex(rtcd_init_mutex);
+        return;
+    }
+    table_set   = true;
+    table_flags = flags;
+
+    /* Avoid check that pointer is set double, after first setup. */
+    static bool first_call_setup = true;
+    bool        check_pointer_was_set = first_call_setup;
+    first_call_setup = false;
 
 #if defined ARCH_X86_64
     SET_AVX2(svt_aom_sse, svt_aom_sse_c, svt_aom_sse_avx2);
 #if CONFIG_ENABLE_HIGH_BIT_DEPTH
     SET_AVX2(svt_aom_highbd_sse, svt_aom_highbd_sse_c, svt_aom_highbd_sse_avx2);
 #endif
-    SET_ONLY_C(svt_av1_get_crc32c_value, svt_av1_get_crc32c_value_c);
+    SET_SSE42(svt_av1_get_crc32c_value, svt_av1_get_crc32c_value_c, svt_av1_get_crc32c_value_sse4_2);
     SET_AVX2(svt_av1_wedge_compute_delta_squares, svt_av1_wedge_compute_delta_squares_c, svt_av1_wedge_compute_delta_squares_avx2);
     SET_SSE2_AVX2(svt_av1_wedge_sign_from_residuals, svt_av1_wedge_sign_from_residuals_c, svt_av1_wedge_sign_from_residuals_sse2, svt_av1_wedge_sign_from_residuals_avx2);
     SET_SSE41_AVX2(svt_compute_cdef_dist_16bit, svt_aom_compute_cdef_dist_16bit_c, svt_aom_compute_cdef_dist_16bit_sse4_1, svt_aom_compute_cdef_dist_16bit_avx2);
@@ -566,6 +592,8 @@ void svt_aom_setup_rtcd_internal(EbCpuFlags flags) {
     SET_AVX2(svt_av1_highbd_resize_plane, svt_av1_highbd_resize_plane_c, svt_av1_highbd_resize_plane_avx2);
 #endif
     SET_AVX2(svt_av1_resize_plane, svt_av1_resize_plane_c, svt_av1_resize_plane_avx2);
+    SET_AVX2(svt_av1_convolve_horiz_rs, svt_av1_convolve_horiz_rs_c, svt_av1_convolve_horiz_rs_avx2);
+    SET_AVX2(svt_av1_highbd_convolve_horiz_rs, svt_av1_highbd_convolve_horiz_rs_c, svt_av1_highbd_convolve_horiz_rs_avx2);
     SET_AVX2(svt_av1_compute_cul_level, svt_av1_compute_cul_level_c, svt_av1_compute_cul_level_avx2);
     SET_AVX2(svt_ssim_8x8, svt_ssim_8x8_c, svt_ssim_8x8_avx2);
     SET_AVX2(svt_ssim_4x4, svt_ssim_4x4_c, svt_ssim_4x4_avx2);
@@ -576,7 +604,7 @@ void svt_aom_setup_rtcd_internal(EbCpuFlags flags) {
 #if CONFIG_ENABLE_HIGH_BIT_DEPTH
     SET_NEON_SVE(svt_aom_highbd_sse, svt_aom_highbd_sse_c, svt_aom_highbd_sse_neon, svt_aom_highbd_sse_sve);
 #endif
-    SET_ONLY_C(svt_av1_get_crc32c_value, svt_av1_get_crc32c_value_c);
+    SET_ARM_CRC32(svt_av1_get_crc32c_value, svt_av1_get_crc32c_value_c, svt_av1_get_crc32c_value_arm_crc32);
     SET_NEON(svt_av1_wedge_compute_delta_squares, svt_av1_wedge_compute_delta_squares_c, svt_av1_wedge_compute_delta_squares_neon);
     SET_NEON_SVE(svt_av1_wedge_sign_from_residuals, svt_av1_wedge_sign_from_residuals_c, svt_av1_wedge_sign_from_residuals_neon, svt_av1_wedge_sign_from_residuals_sve);
     SET_NEON_SVE(svt_compute_cdef_dist_16bit, svt_aom_compute_cdef_dist_16bit_c, svt_aom_compute_cdef_dist_16bit_neon, svt_aom_compute_cdef_dist_16bit_sve);
@@ -933,7 +961,7 @@ void svt_aom_setup_rtcd_internal(EbCpuFlags flags) {
     SET_ONLY_C(svt_aom_flat_block_finder_extract_block, svt_aom_flat_block_finder_extract_block_c);
 #endif
 #if CONFIG_ENABLE_OBMC
-    SET_ONLY_C(svt_av1_calc_target_weighted_pred_above, svt_av1_calc_target_weighted_pred_above_c);
+    SET_NEON(svt_av1_calc_target_weighted_pred_above, svt_av1_calc_target_weighted_pred_above_c, svt_av1_calc_target_weighted_pred_above_neon);
     SET_NEON(svt_av1_calc_target_weighted_pred_left, svt_av1_calc_target_weighted_pred_left_c, svt_av1_calc_target_weighted_pred_left_neon);
 #endif
     SET_ONLY_C(svt_av1_interpolate_core, svt_av1_interpolate_core_c);
@@ -944,6 +972,8 @@ void svt_aom_setup_rtcd_internal(EbCpuFlags flags) {
     SET_ONLY_C(svt_av1_highbd_resize_plane, svt_av1_highbd_resize_plane_c);
 #endif
     SET_ONLY_C(svt_av1_resize_plane, svt_av1_resize_plane_c);
+    SET_NEON(svt_av1_convolve_horiz_rs, svt_av1_convolve_horiz_rs_c, svt_av1_convolve_horiz_rs_neon);
+    SET_NEON(svt_av1_highbd_convolve_horiz_rs, svt_av1_highbd_convolve_horiz_rs_c, svt_av1_highbd_convolve_horiz_rs_neon);
     SET_NEON_SVE(svt_av1_compute_cul_level, svt_av1_compute_cul_level_c, svt_av1_compute_cul_level_neon, svt_av1_compute_cul_level_sve);
     SET_NEON_NEON_DOTPROD(svt_ssim_8x8, svt_ssim_8x8_c, svt_ssim_8x8_c, svt_ssim_8x8_neon_dotprod);
     SET_NEON_NEON_DOTPROD(svt_ssim_4x4, svt_ssim_4x4_c, svt_ssim_4x4_c, svt_ssim_4x4_neon_dotprod);
@@ -1320,6 +1350,8 @@ void svt_aom_setup_rtcd_internal(EbCpuFlags flags) {
     SET_ONLY_C(svt_av1_highbd_resize_plane, svt_av1_highbd_resize_plane_c);
 #endif
     SET_ONLY_C(svt_av1_resize_plane, svt_av1_resize_plane_c);
+    SET_ONLY_C(svt_av1_convolve_horiz_rs, svt_av1_convolve_horiz_rs_c);
+    SET_ONLY_C(svt_av1_highbd_convolve_horiz_rs, svt_av1_highbd_convolve_horiz_rs_c);
     SET_ONLY_C(svt_av1_compute_cul_level, svt_av1_compute_cul_level_c);
     SET_ONLY_C(svt_ssim_8x8, svt_ssim_8x8_c);
     SET_ONLY_C(svt_ssim_4x4, svt_ssim_4x4_c);
@@ -456,10 +456,6 @@ void svt_aom_setup_common_rtcd_internal(EbCpuFlags flags) {
     RUN_ONCE_MUTEX(common_rtcd_init_mutex);
     svt_block_on_mutex(common_rtcd_init_mutex);
 
-    /* Avoid check that pointer is set double, after first setup. */
-    static bool first_call_setup = true;
-    bool        check_pointer_was_set = first_call_setup;
-    first_call_setup = false;
     /** Should be done during library initialization,
         but for safe limiting cpu flags again. */
 #if defined ARCH_X86_64 || defined ARCH_AARCH64
@@ -468,6 +464,21 @@ void svt_aom_setup_common_rtcd_internal(EbCpuFlags flags) {
     flags = 0;
     //to use C: flags=0
 #endif
+    /* The table is process-wide: every further encoder instance asking for the same
+       flags finds it already set and skips rewriting it under running instances. */
+    static bool       table_set   = false;
+    static EbCpuFlags table_flags = 0;
+    if (table_set && table_flags == flags) {
+        svt_release_mutex(common_rtcd_init_mutex);
+        return;
+    }
+    table_set   = true;
+    table_flags = flags;
+
+    /* Avoid check that pointer is set double, after first setup. */
+    static bool first_call_setup = true;
+    bool        check_pointer_was_set = first_call_setup;
+    first_call_setup = false;
 
 #ifdef ARCH_X86_64
     SET_SSE41_AVX2(svt_aom_blend_a64_mask, svt_aom_blend_a64_mask_c, svt_aom_blend_a64_mask_sse4_1, svt_aom_blend_a64_mask_avx2);
@@ -1994,6 +1994,12 @@ EbPtr handle;
 void(*error_handler)(
     EbPtr handle,
     uint32_t errorCode);
+// Optional application hook fired each time a packet is posted to the output stream fifo
+void(*packet_ready_handler)(
+    void* context);
+void* packet_ready_context;
+// Optional application allocator for output packet payloads, used when alloc is set
+SvtAv1PacketAllocator packet_allocator;
 } EbCallback;
 
 // Common Macros
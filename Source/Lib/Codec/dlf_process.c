@@ -103,7 +103,10 @@ void* svt_aom_dlf_kernel(void* input_ptr) {
             EbPictureBufferDesc* recon_buffer;
             svt_aom_get_recon_pic(pcs, &recon_buffer, is_16bit);
             svt_av1_loop_filter_init(pcs);
-            svt_av1_pick_filter_level((EbPictureBufferDesc*)pcs->ppcs->enhanced_pic, pcs, LPF_PICK_FROM_FULL_IMAGE);
+            // Tile-parallel pictures pick the same filter levels the SB-based path would have used
+            svt_av1_pick_filter_level((EbPictureBufferDesc*)pcs->ppcs->enhanced_pic,
+                                      pcs,
+                                      pcs->ppcs->dlf_ctrls.sb_based_dlf ? LPF_PICK_FROM_Q : LPF_PICK_FROM_FULL_IMAGE);
             if (pcs->zero_filt_sse == -1 &&
                 (frm_hdr->loop_filter_params.filter_level[0] || frm_hdr->loop_filter_params.filter_level[1])) {
                 pcs->zero_filt_sse = picture_sse_calculations(pcs, recon_buffer, /*plane*/ 0);
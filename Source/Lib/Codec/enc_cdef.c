@@ -651,14 +651,30 @@ static uint64_t joint_strength_search_dual(int32_t* best_lev0, int32_t* best_lev
     }
     /* Performing further refinements on the search based on the results
     from the step above. Trying to refine the greedy search by reconsidering each
-    already-selected option. */
+    already-selected option.
+
+    Each refinement step only depends on the ordered list of selected pairs. If a
+    whole cycle of nb_strengths steps brings the list back to where the cycle
+    started, every later cycle repeats it, and since the number of steps is a
+    multiple of nb_strengths the remaining cycles can be skipped. */
+    int32_t cycle_lev0[CDEF_MAX_STRENGTHS];
+    int32_t cycle_lev1[CDEF_MAX_STRENGTHS];
     for (i = 0; i < 4 * nb_strengths; i++) {
         int32_t j;
+        if (i % nb_strengths == 0) {
+            memcpy(cycle_lev0, best_lev0, nb_strengths * sizeof(*best_lev0));
+            memcpy(cycle_lev1, best_lev1, nb_strengths * sizeof(*best_lev1));
+        }
         for (j = 0; j < nb_strengths - 1; j++) {
             best_lev0[j] = best_lev0[j + 1];
             best_lev1[j] = best_lev1[j + 1];
         }
         best_tot_mse = svt_search_one_dual(best_lev0, best_lev1, nb_strengths - 1, mse, sb_count, start_gi, end_gi);
+        if (i % nb_strengths == nb_strengths - 1 &&
+            !memcmp(cycle_lev0, best_lev0, nb_strengths * sizeof(*best_lev0)) &&
+            !memcmp(cycle_lev1, best_lev1, nb_strengths * sizeof(*best_lev1))) {
+            break;
+        }
     }
     return best_tot_mse;
 }
@@ -29,6 +29,9 @@ static int64_t warp_error(WarpedMotionParams* wm, const uint8_t* const ref, int
     ConvolveParams conv_params   = get_conv_params(0, 0, 0, 8);
     conv_params.use_jnt_comp_avg = 0;
 
+    // With chess sampling the partial sum is doubled at the end, so compare it against half of best_error
+    const int64_t exit_error = chess_refn ? best_error >> 1 : best_error;
+
     int i_itr = 0;
     for (int i = p_row; i < p_row + p_height; i += WARP_ERROR_BLOCK) {
         int jstart = (i_itr & 1) ? p_col : p_col + WARP_ERROR_BLOCK;
@@ -61,8 +64,8 @@ static int64_t warp_error(WarpedMotionParams* wm, const uint8_t* const ref, int
 
             gm_sumerr += svt_nxm_sad_kernel(tmp, WARP_ERROR_BLOCK, dst + j + i * p_stride, p_stride, warp_h, warp_w);
 
-            if (gm_sumerr > best_error) {
-                return gm_sumerr;
+            if (gm_sumerr > exit_error) {
+                return chess_refn ? gm_sumerr * 2 : gm_sumerr;
             }
         }
 
@@ -62,6 +62,7 @@ static void encode_context_dctor(EbPtr p) {
     EB_DESTROY_MUTEX(obj->sc_buffer_mutex);
     EB_DESTROY_MUTEX(obj->stat_file_mutex);
     EB_DESTROY_MUTEX(obj->frame_updated_mutex);
+    EB_DESTROY_MUTEX(obj->rate_info_mutex);
     EB_DELETE(obj->prediction_structure_group_ptr);
     EB_DELETE_PTR_ARRAY(obj->picture_decision_reorder_queue, obj->picture_decision_reorder_queue_size);
     obj->picture_decision_reorder_queue_size = 0;
@@ -95,6 +96,7 @@ EbErrorType svt_aom_encode_context_ctor(EncodeContext* enc_ctx, EbPtr object_ini
 
     EB_CREATE_MUTEX(enc_ctx->total_number_of_recon_frame_mutex);
     EB_CREATE_MUTEX(enc_ctx->frame_updated_mutex);
+    EB_CREATE_MUTEX(enc_ctx->rate_info_mutex);
     enc_ctx->picture_decision_reorder_queue_size = 0;
     EB_ALLOC_PTR_ARRAY(enc_ctx->pre_assignment_buffer, PRE_ASSIGNMENT_MAX_DEPTH);
 
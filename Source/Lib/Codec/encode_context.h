@@ -180,6 +180,13 @@ typedef struct EncodeContext {
     EbHandle                          rc_param_queue_mutex;
     // reference scaling random access event
     EbRefFrameScale resize_evt;
+    // Rate targets requested with svt_av1_enc_update_rate_info(): the sequence QP and max bit rate are
+    // taken by the next input picture, the target bit rate by the next mini-GOP
+    SvtAv1RateUpdate rate_info;
+    EbHandle         rate_info_mutex;
+    // Ids of the last target bit rate taken by picture decision and applied by rate control
+    uint32_t rate_info_id;
+    uint32_t rate_info_applied_id;
     //Superblock end index for cycling refresh through the frame.
     uint32_t         cr_sb_end;
     SvtAv1RoiMapEvt* roi_map_evt;
@@ -487,51 +487,108 @@ void svt_aom_estimate_mv_rate(PictureControlSet* pcs, MdRateEstimationContext* m
     }
 }
 
+// True when the costs derived from cur must be recomputed: either the table was never built, or the CDF differs
+// from the one it was built from
+static INLINE bool coeff_cdf_changed(const MdRateEstimationContext* md_rate_est_ctx, const void* src, const void* cur,
+                                     size_t size) {
+    return !md_rate_est_ctx->coeff_cdf_src_valid || memcmp(src, cur, size);
+}
+
 /**************************************************************************
  * svt_aom_estimate_coefficients_rate()
  * Estimate the rate of the quantized coefficient
- * based on the frame CDF
+ * based on the frame CDF. Only the costs whose CDFs changed since the
+ * previous call on the same table are recomputed.
  ***************************************************************************/
 void svt_aom_estimate_coefficients_rate(MdRateEstimationContext* md_rate_est_ctx, FRAME_CONTEXT* fc) {
-    const int32_t num_planes = 3; // NM - Hardcoded to 3
-    const int32_t nplanes    = AOMMIN(num_planes, PLANE_TYPES);
+    const int32_t     num_planes = 3; // NM - Hardcoded to 3
+    const int32_t     nplanes    = AOMMIN(num_planes, PLANE_TYPES);
+    CoeffCdfSnapshot* src        = &md_rate_est_ctx->coeff_cdf_src;
 
     for (int eob_multi_size = 0; eob_multi_size < 7; ++eob_multi_size) {
         for (int plane = 0; plane < nplanes; ++plane) {
             LvMapEobCost* pcost = &md_rate_est_ctx->eob_frac_bits[eob_multi_size][plane];
+            AomCdfProb*   pcdf;
+            AomCdfProb*   psrc;
+            size_t        size;
+            switch (eob_multi_size) {
+            case 0:
+                pcdf = fc->eob_flag_cdf16[plane][0];
+                psrc = src->eob_flag_cdf16[plane][0];
+                size = sizeof(src->eob_flag_cdf16[plane]);
+                break;
+            case 1:
+                pcdf = fc->eob_flag_cdf32[plane][0];
+                psrc = src->eob_flag_cdf32[plane][0];
+                size = sizeof(src->eob_flag_cdf32[plane]);
+                break;
+            case 2:
+                pcdf = fc->eob_flag_cdf64[plane][0];
+                psrc = src->eob_flag_cdf64[plane][0];
+                size = sizeof(src->eob_flag_cdf64[plane]);
+                break;
+            case 3:
+                pcdf = fc->eob_flag_cdf128[plane][0];
+                psrc = src->eob_flag_cdf128[plane][0];
+                size = sizeof(src->eob_flag_cdf128[plane]);
+                break;
+            case 4:
+                pcdf = fc->eob_flag_cdf256[plane][0];
+                psrc = src->eob_flag_cdf256[plane][0];
+                size = sizeof(src->eob_flag_cdf256[plane]);
+                break;
+            case 5:
+                pcdf = fc->eob_flag_cdf512[plane][0];
+                psrc = src->eob_flag_cdf512[plane][0];
+                size = sizeof(src->eob_flag_cdf512[plane]);
+                break;
+            case 6:
+            default:
+                pcdf = fc->eob_flag_cdf1024[plane][0];
+                psrc = src->eob_flag_cdf1024[plane][0];
+                size = sizeof(src->eob_flag_cdf1024[plane]);
+                break;
+            }
+            if (!coeff_cdf_changed(md_rate_est_ctx, psrc, pcdf, size)) {
+                continue;
+            }
+            // Both contexts are stored back to back, CDF_SIZE(eob_multi_size + 5) entries each
             for (int ctx = 0; ctx < 2; ++ctx) {
-                AomCdfProb* pcdf;
-                switch (eob_multi_size) {
-                case 0:
-                    pcdf = fc->eob_flag_cdf16[plane][ctx];
-                    break;
-                case 1:
-                    pcdf = fc->eob_flag_cdf32[plane][ctx];
-                    break;
-                case 2:
-                    pcdf = fc->eob_flag_cdf64[plane][ctx];
-                    break;
-                case 3:
-                    pcdf = fc->eob_flag_cdf128[plane][ctx];
-                    break;
-                case 4:
-                    pcdf = fc->eob_flag_cdf256[plane][ctx];
-                    break;
-                case 5:
-                    pcdf = fc->eob_flag_cdf512[plane][ctx];
-                    break;
-                case 6:
-                default:
-                    pcdf = fc->eob_flag_cdf1024[plane][ctx];
-                    break;
-                }
-                svt_aom_get_syntax_rate_from_cdf(pcost->eob_cost[ctx], pcdf, NULL);
+                svt_aom_get_syntax_rate_from_cdf(pcost->eob_cost[ctx], pcdf + ctx * CDF_SIZE(eob_multi_size + 5), NULL);
             }
         }
     }
     for (int tx_size = 0; tx_size < TX_SIZES; ++tx_size) {
         for (int plane = 0; plane < nplanes; ++plane) {
             LvMapCoeffCost* pcost = &md_rate_est_ctx->coeff_fac_bits[tx_size][plane];
+            const int       br_tx = AOMMIN(tx_size, TX_32X32);
+
+            if (!coeff_cdf_changed(md_rate_est_ctx,
+                                   src->txb_skip_cdf[tx_size],
+                                   fc->txb_skip_cdf[tx_size],
+                                   sizeof(src->txb_skip_cdf[tx_size])) &&
+                !coeff_cdf_changed(md_rate_est_ctx,
+                                   src->coeff_base_eob_cdf[tx_size][plane],
+                                   fc->coeff_base_eob_cdf[tx_size][plane],
+                                   sizeof(src->coeff_base_eob_cdf[tx_size][plane])) &&
+                !coeff_cdf_changed(md_rate_est_ctx,
+                                   src->coeff_base_cdf[tx_size][plane],
+                                   fc->coeff_base_cdf[tx_size][plane],
+                                   sizeof(src->coeff_base_cdf[tx_size][plane])) &&
+                !coeff_cdf_changed(md_rate_est_ctx,
+                                   src->eob_extra_cdf[tx_size][plane],
+                                   fc->eob_extra_cdf[tx_size][plane],
+                                   sizeof(src->eob_extra_cdf[tx_size][plane])) &&
+                !coeff_cdf_changed(md_rate_est_ctx,
+                                   src->dc_sign_cdf[plane],
+                                   fc->dc_sign_cdf[plane],
+                                   sizeof(src->dc_sign_cdf[plane])) &&
+                !coeff_cdf_changed(md_rate_est_ctx,
+                                   src->coeff_br_cdf[br_tx][plane],
+                                   fc->coeff_br_cdf[br_tx][plane],
+                                   sizeof(src->coeff_br_cdf[br_tx][plane]))) {
+                continue;
+            }
 
             for (int ctx = 0; ctx < TXB_SKIP_CONTEXTS; ++ctx) {
                 svt_aom_get_syntax_rate_from_cdf(pcost->txb_skip_cost[ctx], fc->txb_skip_cdf[tx_size][ctx], NULL);
@@ -563,8 +620,7 @@ void svt_aom_estimate_coefficients_rate(MdRateEstimationContext* md_rate_est_ctx
                 int32_t br_rate[BR_CDF_SIZE];
                 int32_t prev_cost = 0;
                 int32_t i, j;
-                svt_aom_get_syntax_rate_from_cdf(
-                    br_rate, fc->coeff_br_cdf[AOMMIN(tx_size, TX_32X32)][plane][ctx], NULL);
+                svt_aom_get_syntax_rate_from_cdf(br_rate, fc->coeff_br_cdf[br_tx][plane][ctx], NULL);
                 // SVT_LOG("br_rate: ");
                 // for(j = 0; j < BR_CDF_SIZE; j++)
                 //  SVT_LOG("%4d ", br_rate[j]);
@@ -590,6 +646,21 @@ void svt_aom_estimate_coefficients_rate(MdRateEstimationContext* md_rate_est_ctx
             }
         }
     }
+
+    memcpy(src->txb_skip_cdf, fc->txb_skip_cdf, sizeof(src->txb_skip_cdf));
+    memcpy(src->eob_extra_cdf, fc->eob_extra_cdf, sizeof(src->eob_extra_cdf));
+    memcpy(src->dc_sign_cdf, fc->dc_sign_cdf, sizeof(src->dc_sign_cdf));
+    memcpy(src->eob_flag_cdf16, fc->eob_flag_cdf16, sizeof(src->eob_flag_cdf16));
+    memcpy(src->eob_flag_cdf32, fc->eob_flag_cdf32, sizeof(src->eob_flag_cdf32));
+    memcpy(src->eob_flag_cdf64, fc->eob_flag_cdf64, sizeof(src->eob_flag_cdf64));
+    memcpy(src->eob_flag_cdf128, fc->eob_flag_cdf128, sizeof(src->eob_flag_cdf128));
+    memcpy(src->eob_flag_cdf256, fc->eob_flag_cdf256, sizeof(src->eob_flag_cdf256));
+    memcpy(src->eob_flag_cdf512, fc->eob_flag_cdf512, sizeof(src->eob_flag_cdf512));
+    memcpy(src->eob_flag_cdf1024, fc->eob_flag_cdf1024, sizeof(src->eob_flag_cdf1024));
+    memcpy(src->coeff_base_eob_cdf, fc->coeff_base_eob_cdf, sizeof(src->coeff_base_eob_cdf));
+    memcpy(src->coeff_base_cdf, fc->coeff_base_cdf, sizeof(src->coeff_base_cdf));
+    memcpy(src->coeff_br_cdf, fc->coeff_br_cdf, sizeof(src->coeff_br_cdf));
+    md_rate_est_ctx->coeff_cdf_src_valid = true;
 }
 
 static INLINE AomCdfProb* get_y_mode_cdf(FRAME_CONTEXT* tile_ctx, const MacroBlockD* xd) {
@@ -43,6 +43,24 @@ typedef struct LvMapCoeffCost {
     int32_t lps_cost[LEVEL_CONTEXTS][COEFF_BASE_RANGE + 1 + COEFF_BASE_RANGE + 1];
 } LvMapCoeffCost;
 
+// Copy of the coefficient CDFs a rate table was last built from, so that only the
+// costs whose CDFs changed are recomputed on the next update
+typedef struct CoeffCdfSnapshot {
+    AomCdfProb txb_skip_cdf[TX_SIZES][TXB_SKIP_CONTEXTS][CDF_SIZE(2)];
+    AomCdfProb eob_extra_cdf[TX_SIZES][PLANE_TYPES][EOB_COEF_CONTEXTS][CDF_SIZE(2)];
+    AomCdfProb dc_sign_cdf[PLANE_TYPES][DC_SIGN_CONTEXTS][CDF_SIZE(2)];
+    AomCdfProb eob_flag_cdf16[PLANE_TYPES][2][CDF_SIZE(5)];
+    AomCdfProb eob_flag_cdf32[PLANE_TYPES][2][CDF_SIZE(6)];
+    AomCdfProb eob_flag_cdf64[PLANE_TYPES][2][CDF_SIZE(7)];
+    AomCdfProb eob_flag_cdf128[PLANE_TYPES][2][CDF_SIZE(8)];
+    AomCdfProb eob_flag_cdf256[PLANE_TYPES][2][CDF_SIZE(9)];
+    AomCdfProb eob_flag_cdf512[PLANE_TYPES][2][CDF_SIZE(10)];
+    AomCdfProb eob_flag_cdf1024[PLANE_TYPES][2][CDF_SIZE(11)];
+    AomCdfProb coeff_base_eob_cdf[TX_SIZES][PLANE_TYPES][SIG_COEF_CONTEXTS_EOB][CDF_SIZE(3)];
+    AomCdfProb coeff_base_cdf[TX_SIZES][PLANE_TYPES][SIG_COEF_CONTEXTS][CDF_SIZE(4)];
+    AomCdfProb coeff_br_cdf[TX_32X32 + 1][PLANE_TYPES][LEVEL_CONTEXTS][CDF_SIZE(BR_CDF_SIZE)];
+} CoeffCdfSnapshot;
+
 /**************************************
      * MD Rate Estimation Structure
      **************************************/
@@ -122,6 +140,9 @@ typedef struct MdRateEstimationContext {
     int32_t        intra_tx_type_fac_bits[EXT_TX_SETS_INTRA][EXT_TX_SIZES][INTRA_MODES][TX_TYPES];
     int32_t        inter_tx_type_fac_bits[EXT_TX_SETS_INTER][EXT_TX_SIZES][TX_TYPES];
     bool           initialized;
+    // Source CDFs of coeff_fac_bits/eob_frac_bits; valid once the coefficient rates have been estimated
+    CoeffCdfSnapshot coeff_cdf_src;
+    bool             coeff_cdf_src_valid;
 } MdRateEstimationContext;
 
 /***************************************************************************
@@ -295,13 +295,37 @@ static void collect_frames_info(PacketizationContext* context_ptr, const EncodeC
 
 #define TD_SIZE 2
 
+// Allocate an output packet payload, from the application allocator when one is registered
+static uint8_t* alloc_packet_payload(const EbBufferHeaderType* output_stream_ptr, uint32_t size) {
+    const EbCallback* app_callback_ptr = ((const EbOutputStreamBuffer*)output_stream_ptr)->app_callback_ptr;
+    if (app_callback_ptr && app_callback_ptr->packet_allocator.alloc) {
+        return (uint8_t*)app_callback_ptr->packet_allocator.alloc(app_callback_ptr->packet_allocator.context, size);
+    }
+    uint8_t* pbuff;
+    EB_NO_THROW_MALLOC(pbuff, size);
+    return pbuff;
+}
+
+void svt_aom_free_packet_payload(EbBufferHeaderType* output_stream_ptr) {
+    if (!output_stream_ptr->p_buffer) {
+        return;
+    }
+    const EbCallback* app_callback_ptr = ((const EbOutputStreamBuffer*)output_stream_ptr)->app_callback_ptr;
+    if (app_callback_ptr && app_callback_ptr->packet_allocator.alloc) {
+        app_callback_ptr->packet_allocator.free(app_callback_ptr->packet_allocator.context,
+                                                output_stream_ptr->p_buffer);
+        output_stream_ptr->p_buffer = NULL;
+    } else {
+        EB_FREE(output_stream_ptr->p_buffer);
+    }
+}
+
 // a tu start with a td, + 0 more not displable frame, + 1 display frame
 static EbErrorType encode_tu(EncodeContext* enc_ctx, int frames, uint32_t total_bytes,
                              EbBufferHeaderType* output_stream_ptr) {
     total_bytes += TD_SIZE;
     if (total_bytes > output_stream_ptr->n_alloc_len) {
-        uint8_t* pbuff;
-        EB_MALLOC(pbuff, total_bytes);
+        uint8_t* pbuff = alloc_packet_payload(output_stream_ptr, total_bytes);
         if (!pbuff) {
             SVT_ERROR("failed to allocate more memory in encode_tu");
             return EB_ErrorInsufficientResources;
@@ -309,7 +333,7 @@ static EbErrorType encode_tu(EncodeContext* enc_ctx, int frames, uint32_t total_
         svt_memcpy(pbuff,
                    output_stream_ptr->p_buffer,
                    output_stream_ptr->n_alloc_len > total_bytes ? total_bytes : output_stream_ptr->n_alloc_len);
-        EB_FREE(output_stream_ptr->p_buffer);
+        svt_aom_free_packet_payload(output_stream_ptr);
         output_stream_ptr->p_buffer    = pbuff;
         output_stream_ptr->n_alloc_len = total_bytes;
     }
@@ -322,13 +346,15 @@ static EbErrorType encode_tu(EncodeContext* enc_ctx, int frames, uint32_t total_
         uint32_t                   size            = src_stream_ptr->n_filled_len;
         dst -= size;
         memmove(dst, src_stream_ptr->p_buffer, size);
+        // the temporal unit is in error if any of its frames is
+        output_stream_ptr->flags |= src_stream_ptr->flags & EB_BUFFERFLAG_ERROR_MASK;
         // 1. The last frame is a displayable frame, others are undisplayed.
         // 2. We do not push alt ref frame since the overlay frame will carry the pts.
         // 3. Release alt ref stream buffer here for it will not be sent out
         if (i != frames - 1 && !queue_entry_ptr->is_alt_ref) {
             push_undisplayed_frame(enc_ctx, wrapper);
         } else if (queue_entry_ptr->is_alt_ref) {
-            EB_FREE(src_stream_ptr->p_buffer);
+            svt_aom_free_packet_payload(src_stream_ptr);
             svt_release_object(wrapper);
         }
     }
@@ -362,6 +388,10 @@ static void encode_show_existing(EncodeContext* enc_ctx, PacketizationReorderEnt
                                  EbBufferHeaderType* output_stream_ptr) {
     uint8_t* dst = output_stream_ptr->p_buffer;
 
+    // the payload could not be allocated, the packet is already flagged in error
+    if (!dst) {
+        return;
+    }
     svt_aom_encode_td_av1(dst);
     output_stream_ptr->n_filled_len = TD_SIZE;
 
@@ -434,10 +464,17 @@ inline static void set_eos_flag(EbBufferHeaderType* output_stream_ptr) {
     output_stream_ptr->flags |= EB_BUFFERFLAG_EOS;
 }
 
-/* Wrapper function to capture the return of EB_MALLOC */
+void svt_aom_post_output_stream(EbCallback* app_callback_ptr, EbObjectWrapper* output_stream_wrapper_ptr) {
+    svt_post_full_object(output_stream_wrapper_ptr);
+    // Notify after posting so that the packet can be fetched from within the callback
+    if (app_callback_ptr && app_callback_ptr->packet_ready_handler) {
+        app_callback_ptr->packet_ready_handler(app_callback_ptr->packet_ready_context);
+    }
+}
+
 static inline EbErrorType malloc_p_buffer(EbBufferHeaderType* output_stream_ptr) {
-    EB_MALLOC(output_stream_ptr->p_buffer, output_stream_ptr->n_alloc_len);
-    return EB_ErrorNone;
+    output_stream_ptr->p_buffer = alloc_packet_payload(output_stream_ptr, output_stream_ptr->n_alloc_len);
+    return output_stream_ptr->p_buffer ? EB_ErrorNone : EB_ErrorInsufficientResources;
 }
 
 void update_firstpass_stats(PictureParentControlSet* pcs, const int frame_number, const double ts_duration,
@@ -794,11 +831,14 @@ void* svt_aom_packetization_kernel(void* input_ptr) {
 
         output_stream_ptr->n_alloc_len = (uint32_t)(svt_aom_bitstream_get_bytes_count(pcs->bitstream_ptr) + TD_SIZE +
                                                     metadata_sz);
-        malloc_p_buffer(output_stream_ptr);
-
-        assert(output_stream_ptr->p_buffer != NULL && "bit-stream memory allocation failure");
-
-        copy_data_from_bitstream(enc_ctx, pcs->bitstream_ptr, output_stream_ptr);
+        if (malloc_p_buffer(output_stream_ptr) != EB_ErrorNone) {
+            // The picture is lost: its packet goes out empty and flagged, svt_av1_enc_get_packet() reports the error
+            SVT_ERROR("failed to allocate the packet payload of picture %d\n", (int32_t)pcs->picture_number);
+            output_stream_ptr->n_alloc_len = 0;
+            output_stream_ptr->flags |= EB_BUFFERFLAG_ERROR_MASK;
+        } else {
+            copy_data_from_bitstream(enc_ctx, pcs->bitstream_ptr, output_stream_ptr);
+        }
 
         if (pcs->ppcs->has_show_existing) {
             uint64_t next_picture_number = pcs->picture_number + 1;
@@ -902,13 +942,15 @@ void* svt_aom_packetization_kernel(void* input_ptr) {
             output_stream_wrapper_ptr = queue_entry_ptr->output_stream_wrapper_ptr;
             output_stream_ptr         = (EbBufferHeaderType*)output_stream_wrapper_ptr->object_ptr;
             eos                       = output_stream_ptr->flags & EB_BUFFERFLAG_EOS;
-            encode_tu(enc_ctx, frames, total_bytes, output_stream_ptr);
+            if (encode_tu(enc_ctx, frames, total_bytes, output_stream_ptr) != EB_ErrorNone) {
+                output_stream_ptr->flags |= EB_BUFFERFLAG_ERROR_MASK;
+            }
 
             if (eos && queue_entry_ptr->has_show_existing) {
                 clear_eos_flag(output_stream_ptr);
             }
 
-            svt_post_full_object(output_stream_wrapper_ptr);
+            svt_aom_post_output_stream(enc_ctx->app_callback_ptr, output_stream_wrapper_ptr);
             if (queue_entry_ptr->has_show_existing) {
                 EbObjectWrapper* existed = pop_undisplayed_frame(enc_ctx);
                 if (existed) {
@@ -917,7 +959,7 @@ void* svt_aom_packetization_kernel(void* input_ptr) {
                     if (eos) {
                         set_eos_flag(existed_output_stream_ptr);
                     }
-                    svt_post_full_object(existed);
+                    svt_aom_post_output_stream(enc_ctx->app_callback_ptr, existed);
                 }
             }
 
@@ -938,7 +980,7 @@ void* svt_aom_packetization_kernel(void* input_ptr) {
             tmp_out_str->flags        = EB_BUFFERFLAG_EOS;
             tmp_out_str->n_filled_len = 0;
 
-            svt_post_full_object(tmp_out_str_wrp);
+            svt_aom_post_output_stream(enc_ctx->app_callback_ptr, tmp_out_str_wrp);
             release_references_eos(scs);
         }
         svt_release_mutex(enc_ctx->total_number_of_shown_frames_mutex);
@@ -17,6 +17,15 @@
 extern "C" {
 #endif
 
+/**************************************
+ * Output stream buffer object: the packet header handed to the application, followed by the callbacks
+ * used to allocate its payload. The header must stay the first member, as the application only sees it.
+ **************************************/
+typedef struct EbOutputStreamBuffer {
+    EbBufferHeaderType header;
+    EbCallback*        app_callback_ptr;
+} EbOutputStreamBuffer;
+
 /**************************************
  * Extern Function Declarations
  **************************************/
@@ -24,6 +33,10 @@ EbErrorType svt_aom_packetization_context_ctor(EbThreadContext* thread_ctx, cons
                                                int rate_control_index, int demux_index, int me_port_index);
 
 void* svt_aom_packetization_kernel(void* input_ptr);
+// Free the payload of an output stream buffer with the allocator it was allocated from
+void svt_aom_free_packet_payload(EbBufferHeaderType* output_stream_ptr);
+// Post an output stream buffer to the application and fire the packet-ready callback, if registered
+void svt_aom_post_output_stream(EbCallback* app_callback_ptr, EbObjectWrapper* output_stream_wrapper_ptr);
 // Release the pd_dpb and ref_pic_list at the end of the sequence
 void release_references_eos(SequenceControlSet* scs);
 #ifdef __cplusplus
@@ -445,7 +445,8 @@ void search_palette_luma(PictureControlSet* pcs, ModeDecisionContext* ctx, Palet
     int top_colors[PALETTE_MAX_SIZE] = {0};
     for (int i = 0; i < max_n; ++i) {
         int max_count = 0;
-        for (int j = 0; j < (1 << palette_bit_depth); ++j) {
+        // Every used bin lies in [lb, ub], so there is no need to scan the whole histogram
+        for (int j = lb; j <= ub; ++j) {
             if (count_buf[j] > max_count) {
                 max_count     = count_buf[j];
                 top_colors[i] = j;
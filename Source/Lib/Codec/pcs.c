@@ -501,7 +501,23 @@ static EbErrorType picture_control_set_ctor(PictureControlSet* object_ptr, EbPtr
         set_restoration_unit_size(
             init_data_ptr->picture_width, init_data_ptr->picture_height, 1, 1, object_ptr->rst_info);
 
-        return_error = svt_av1_alloc_restoration_buffers(object_ptr, init_data_ptr->av1_cm);
+        // Sized for the full resolution. The parent av1_cm follows the size of the picture being coded, which a
+        // resized or superres picture shrinks, and this object may be constructed while one is in flight.
+        Av1Common cm;
+        memset(&cm, 0, sizeof(cm));
+        cm.subsampling_x                     = subsampling_x;
+        cm.subsampling_y                     = subsampling_y;
+        cm.mi_cols                           = init_data_ptr->picture_width >> MI_SIZE_LOG2;
+        cm.mi_rows                           = init_data_ptr->picture_height >> MI_SIZE_LOG2;
+        cm.frm_size.frame_width              = init_data_ptr->picture_width - init_data_ptr->non_m8_pad_w;
+        cm.frm_size.frame_height             = init_data_ptr->picture_height - init_data_ptr->non_m8_pad_h;
+        cm.frm_size.superres_upscaled_width  = cm.frm_size.frame_width;
+        cm.frm_size.superres_upscaled_height = cm.frm_size.frame_height;
+        cm.frm_size.superres_denominator     = SCALE_NUMERATOR;
+        return_error                         = svt_av1_alloc_restoration_buffers(object_ptr, &cm);
+        if (return_error != EB_ErrorNone) {
+            return return_error;
+        }
 
         int32_t ntiles[2];
         for (int32_t is_uv = 0; is_uv < 2; ++is_uv) {
@@ -1149,9 +1165,8 @@ static void picture_parent_control_set_dctor(EbPtr ptr) {
     if (obj->is_pcs_sb_params) {
         svt_pcs_sb_structs_dctor(obj);
     }
-    if (obj->frame_superres_enabled || obj->frame_resize_enabled) {
-        EB_DELETE(obj->enhanced_downscaled_pic);
-    }
+    // Kept across pictures, so the last picture built with this pcs may not have been scaled
+    EB_DELETE(obj->enhanced_downscaled_pic);
     EB_DESTROY_SEMAPHORE(obj->tpl_disp_done_semaphore);
     EB_DESTROY_MUTEX(obj->tpl_disp_mutex);
     uint16_t tile_cnt = 1; /*obj->tile_row_count * obj->tile_column_count;*/
@@ -1467,18 +1482,13 @@ static EbErrorType me_ctor(MotionEstimationData* object_ptr, EbPtr object_init_d
     return return_error;
 }
 
-EbErrorType b64_geom_init(SequenceControlSet* scs, uint16_t width, uint16_t height, B64Geom** b64_geoms) {
-    EbErrorType return_error = EB_ErrorNone;
-
+void b64_geom_fill(SequenceControlSet* scs, uint16_t width, uint16_t height, B64Geom* b64_geoms) {
     uint8_t  b64_size           = scs->b64_size;
     uint16_t picture_b64_width  = DIVIDE_AND_CEIL(width, b64_size);
     uint16_t picture_b64_height = DIVIDE_AND_CEIL(height, b64_size);
 
-    EB_FREE_ARRAY(*b64_geoms);
-    EB_MALLOC_ARRAY(*b64_geoms, picture_b64_width * picture_b64_height);
-
     for (int b64_idx = 0; b64_idx < picture_b64_width * picture_b64_height; ++b64_idx) {
-        B64Geom* b64_geom         = &(*b64_geoms)[b64_idx];
+        B64Geom* b64_geom         = &b64_geoms[b64_idx];
         uint16_t horizontal_index = (uint16_t)(b64_idx % picture_b64_width);
         uint16_t vertical_index   = (uint16_t)(b64_idx / picture_b64_width);
         b64_geom->org_x           = horizontal_index * b64_size;
@@ -1487,6 +1497,19 @@ EbErrorType b64_geom_init(SequenceControlSet* scs, uint16_t width, uint16_t heig
         b64_geom->height          = (uint8_t)MIN(height - b64_geom->org_y, b64_size);
         b64_geom->is_complete_b64 = (b64_geom->width == b64_size && b64_geom->height == b64_size) ? 1 : 0;
     }
+}
+
+EbErrorType b64_geom_init(SequenceControlSet* scs, uint16_t width, uint16_t height, B64Geom** b64_geoms) {
+    EbErrorType return_error = EB_ErrorNone;
+
+    uint8_t  b64_size           = scs->b64_size;
+    uint16_t picture_b64_width  = DIVIDE_AND_CEIL(width, b64_size);
+    uint16_t picture_b64_height = DIVIDE_AND_CEIL(height, b64_size);
+
+    EB_FREE_ARRAY(*b64_geoms);
+    EB_MALLOC_ARRAY(*b64_geoms, picture_b64_width * picture_b64_height);
+
+    b64_geom_fill(scs, width, height, *b64_geoms);
 
     return return_error;
 }
@@ -1511,17 +1534,12 @@ void copy_sb_geoms(SbGeom* dst_geom, SbGeom* src_geom, uint16_t width, uint16_t
     }
 }
 
-EbErrorType sb_geom_init(SequenceControlSet* scs, uint16_t width, uint16_t height, SbGeom** sb_geoms) {
+void sb_geom_fill(SequenceControlSet* scs, uint16_t width, uint16_t height, SbGeom* sb_geoms) {
     uint16_t picture_sb_width  = DIVIDE_AND_CEIL(width, scs->sb_size);
     uint16_t picture_sb_height = DIVIDE_AND_CEIL(height, scs->sb_size);
-    free_sb_geoms(*sb_geoms);
-    EbErrorType ret = alloc_sb_geoms(sb_geoms, picture_sb_width, picture_sb_height);
-    if (ret != EB_ErrorNone) {
-        return ret;
-    }
 
     for (int sb_index = 0; sb_index < picture_sb_width * picture_sb_height; ++sb_index) {
-        SbGeom*  sb_geom   = &(*sb_geoms)[sb_index];
+        SbGeom*  sb_geom   = &sb_geoms[sb_index];
         uint16_t hor_index = sb_index % picture_sb_width;
         uint16_t ver_index = sb_index / picture_sb_width;
         sb_geom->org_x     = hor_index * scs->sb_size;
@@ -1529,6 +1547,18 @@ EbErrorType sb_geom_init(SequenceControlSet* scs, uint16_t width, uint16_t heigh
         sb_geom->width     = (uint8_t)MIN(width - sb_geom->org_x, scs->sb_size);
         sb_geom->height    = (uint8_t)MIN(height - sb_geom->org_y, scs->sb_size);
     }
+}
+
+EbErrorType sb_geom_init(SequenceControlSet* scs, uint16_t width, uint16_t height, SbGeom** sb_geoms) {
+    uint16_t picture_sb_width  = DIVIDE_AND_CEIL(width, scs->sb_size);
+    uint16_t picture_sb_height = DIVIDE_AND_CEIL(height, scs->sb_size);
+    free_sb_geoms(*sb_geoms);
+    EbErrorType ret = alloc_sb_geoms(sb_geoms, picture_sb_width, picture_sb_height);
+    if (ret != EB_ErrorNone) {
+        return ret;
+    }
+
+    sb_geom_fill(scs, width, height, *sb_geoms);
 
     return EB_ErrorNone;
 }
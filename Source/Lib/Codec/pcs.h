@@ -204,6 +204,11 @@ typedef struct PictureControlSet {
     uint16_t     rest_segments_total_count;
     uint8_t      rest_segments_column_count;
     uint8_t      rest_segments_row_count;
+    // Restoration application, shared by the thread finishing the search and the helper tasks it posts
+    uint32_t rest_apply_unit_rows; // (plane, restoration unit row) jobs
+    uint32_t rest_apply_next_row;
+    uint16_t rest_apply_helpers;
+    uint16_t rest_apply_threads_done;
     // flag to indicate whether the frame is extended for restoration search
     bool rest_extend_flag[3];
 
@@ -1093,6 +1098,10 @@ typedef struct PictureParentControlSet {
     bool     is_startup_gop;
     uint32_t ahd_error;
 
+    // Target bit rate of the mini-GOP, applied once by rate control (rate_info_id 0 if unchanged)
+    uint32_t target_bit_rate;
+    uint32_t rate_info_id;
+
     bool   sframe_ref_pruned;
     int8_t sframe_qp_offset;
 } PictureParentControlSet;
@@ -1138,13 +1147,12 @@ typedef struct PictureControlSetInitData {
     uint8_t log2_sb_size;
     bool    is_16bit_pipeline;
 
-    uint16_t   non_m8_pad_w;
-    uint16_t   non_m8_pad_h;
-    uint8_t    enable_tpl_la;
-    uint8_t    tpl_synth_size;
-    Av1Common* av1_cm;
-    uint8_t    ref_count_used_list0;
-    uint8_t    ref_count_used_list1;
+    uint16_t non_m8_pad_w;
+    uint16_t non_m8_pad_h;
+    uint8_t  enable_tpl_la;
+    uint8_t  tpl_synth_size;
+    uint8_t  ref_count_used_list0;
+    uint8_t  ref_count_used_list1;
 
     uint8_t aq_mode;
     uint8_t calc_hist;
@@ -1187,6 +1195,9 @@ void svt_aom_get_gm_needed_resolutions(uint8_t ds_lvl, bool* gm_need_full, bool*
 
 EbErrorType b64_geom_init(struct SequenceControlSet* scs, uint16_t width, uint16_t height, B64Geom** b64_geoms);
 EbErrorType sb_geom_init(struct SequenceControlSet* scs, uint16_t width, uint16_t height, SbGeom** sb_geoms);
+// Fill already allocated geometry arrays for a width x height picture
+void b64_geom_fill(struct SequenceControlSet* scs, uint16_t width, uint16_t height, B64Geom* b64_geoms);
+void sb_geom_fill(struct SequenceControlSet* scs, uint16_t width, uint16_t height, SbGeom* sb_geoms);
 EbErrorType alloc_sb_geoms(SbGeom** geom, int width, int height);
 void        free_sb_geoms(SbGeom* geom);
 void        copy_sb_geoms(SbGeom* dst_geom, SbGeom* src_geom, uint16_t width, uint16_t height);
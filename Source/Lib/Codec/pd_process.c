@@ -594,7 +594,10 @@ void dg_detector_hme_level0(PictureParentControlSet* ppcs, uint32_t seg_idx) {
     svt_release_mutex(ppcs->dg_detector->metrics_mutex);
 }
 
-static void early_hme(PictureDecisionContext* ctx, PictureParentControlSet* src_pcs, PictureParentControlSet* ref_pcs) {
+// Send the dg detector segments of src_pcs vs. ref_pcs to the motion estimation kernel. The comparison runs in the ME
+// threads; early_hme_collect() waits for it to complete. Only one comparison per src picture can be in flight.
+static void early_hme_post(PictureDecisionContext* ctx, PictureParentControlSet* src_pcs,
+                           PictureParentControlSet* ref_pcs) {
     // store the ref pic so it can be used by dg detector when the src picture is sent to the motion estimation kernel
     src_pcs->dg_detector->ref_pic = ref_pcs;
 
@@ -618,7 +621,10 @@ static void early_hme(PictureDecisionContext* ctx, PictureParentControlSet* src_
         out_results->task_type     = TASK_DG_DETECTOR_HME;
         svt_post_full_object(out_results_wrp);
     }
+}
 
+// Wait for the comparison posted by early_hme_post() for src_pcs and derive the frame based dg metrics
+static void early_hme_collect(PictureDecisionContext* ctx, PictureParentControlSet* src_pcs) {
     // wait for all segments to complete before the frame based calculations can be performed using the dg metrics
     svt_block_on_semaphore(src_pcs->dg_detector->frame_done_sem);
 
@@ -667,25 +673,29 @@ static void calc_mini_gop_activity(PictureDecisionContext* ctx, EncodeContext* e
 static void eval_sub_mini_gop(PictureDecisionContext* ctx, EncodeContext* enc_ctx, uint64_t top_layer_idx,
                               uint64_t sub_layer_idx0, uint64_t sub_layer_idx1, PictureParentControlSet* start_pcs,
                               PictureParentControlSet* mid_pcs, PictureParentControlSet* end_pcs) {
-    early_hme(ctx, end_pcs, start_pcs);
+    // end->start and mid->start have different source pictures, so their segments are processed by the ME threads
+    // concurrently; end->mid reuses the dg detector of end_pcs and is posted once end->start is done
+    early_hme_post(ctx, end_pcs, start_pcs);
+    early_hme_post(ctx, mid_pcs, start_pcs);
+    early_hme_collect(ctx, end_pcs);
 
     uint64_t dist_end_start            = ctx->norm_dist;
     uint8_t  perc_cplx_end_start       = ctx->perc_cplx;
     uint8_t  perc_active_end_start     = ctx->perc_active;
     int16_t  mv_in_out_count_end_start = ctx->mv_in_out_count;
-    early_hme(ctx, end_pcs, mid_pcs);
-
-    uint64_t dist_end_mid            = ctx->norm_dist;
-    uint8_t  perc_cplx_end_mid       = ctx->perc_cplx;
-    uint8_t  perc_active_end_mid     = ctx->perc_active;
-    int16_t  mv_in_out_count_end_mid = ctx->mv_in_out_count;
-
-    early_hme(ctx, mid_pcs, start_pcs);
+    early_hme_post(ctx, end_pcs, mid_pcs);
+    early_hme_collect(ctx, mid_pcs);
 
     uint64_t dist_mid_start            = ctx->norm_dist;
     uint8_t  perc_cplx_mid_start       = ctx->perc_cplx;
     uint8_t  perc_active_mid_start     = ctx->perc_active;
     int16_t  mv_in_out_count_mid_start = ctx->mv_in_out_count;
+    early_hme_collect(ctx, end_pcs);
+
+    uint64_t dist_end_mid            = ctx->norm_dist;
+    uint8_t  perc_cplx_end_mid       = ctx->perc_cplx;
+    uint8_t  perc_active_end_mid     = ctx->perc_active;
+    int16_t  mv_in_out_count_end_mid = ctx->mv_in_out_count;
 
     calc_mini_gop_activity(ctx,
                            enc_ctx,
@@ -3818,7 +3828,8 @@ bool get_similar_ref_brightness(PictureParentControlSet* pcs) {
     return similar_brightness_refs;
 }
 
-static void send_picture_out(SequenceControlSet* scs, PictureParentControlSet* pcs, PictureDecisionContext* ctx) {
+static EbErrorType send_picture_out(SequenceControlSet* scs, PictureParentControlSet* pcs,
+                                    PictureDecisionContext* ctx) {
     EbObjectWrapper* me_wrapper;
     EbObjectWrapper* out_results_wrapper;
 
@@ -3837,7 +3848,10 @@ static void send_picture_out(SequenceControlSet* scs, PictureParentControlSet* p
     }
     //get a new ME data buffer
     if (pcs->me_data_wrapper == NULL) {
-        svt_get_empty_object(ctx->me_fifo_ptr, &me_wrapper);
+        EbErrorType return_error = svt_get_empty_object(ctx->me_fifo_ptr, &me_wrapper);
+        if (return_error != EB_ErrorNone) {
+            return return_error;
+        }
         pcs->me_data_wrapper = me_wrapper;
         pcs->pa_me_data      = (MotionEstimationData*)me_wrapper->object_ptr;
         me_update_param(pcs->pa_me_data, scs);
@@ -3896,6 +3910,7 @@ static void send_picture_out(SequenceControlSet* scs, PictureParentControlSet* p
         //Post the Full Results Object
         svt_post_full_object(out_results_wrapper);
     }
+    return EB_ErrorNone;
 }
 
 /***************************************************************************************************
@@ -4103,6 +4118,23 @@ static void update_rc_param_queue(PictureParentControlSet* ppcs, EncodeContext*
     ppcs->rate_control_param_ptr = enc_cxt->rc_param_queue[enc_cxt->rc_param_queue_head_index];
 }
 
+/*****************************************************************
+* Take the target bit rate requested with svt_av1_enc_update_rate_info() since the previous
+* mini-GOP, so that all the pictures of the next mini-GOP are encoded with the same one.
+* Returns the id of the request, 0 if there is none
+*****************************************************************/
+static uint32_t take_target_bit_rate(EncodeContext* enc_ctx, uint32_t* target_bit_rate) {
+    uint32_t rate_info_id = 0;
+    svt_block_on_mutex(enc_ctx->rate_info_mutex);
+    *target_bit_rate = enc_ctx->rate_info.target_bit_rate;
+    if (*target_bit_rate) {
+        enc_ctx->rate_info.target_bit_rate = 0;
+        rate_info_id                       = ++enc_ctx->rate_info_id;
+    }
+    svt_release_mutex(enc_ctx->rate_info_mutex);
+    return rate_info_id;
+}
+
 /****************************************************************************************
 * set_layer_depth()
 * Set the layer depth per frame based on frame type, temporal layer
@@ -4231,12 +4263,14 @@ static void perform_scene_change_detection(SequenceControlSet* scs, PictureParen
     ctx->is_scene_change_detected = pcs->scene_change_flag;
 }
 
-// Copy current pic's histogram to temporary buffer to be used by next input pic (N + 1) for scene change detection
-static void copy_histograms(PictureParentControlSet* pcs, PictureDecisionContext* ctx) {
-    for (unsigned int region_in_picture_width_index = 0; region_in_picture_width_index < MAX_NUMBER_OF_REGIONS_IN_WIDTH;
+// Copy current pic's histogram to temporary buffer to be used by next input pic (N + 1) for scene change detection.
+// Only the regions used by the picture analysis are populated, so the rest is not copied.
+static void copy_histograms(SequenceControlSet* scs, PictureParentControlSet* pcs, PictureDecisionContext* ctx) {
+    for (unsigned int region_in_picture_width_index = 0;
+         region_in_picture_width_index < scs->picture_analysis_number_of_regions_per_width;
          region_in_picture_width_index++) {
         for (unsigned int region_in_picture_height_index = 0;
-             region_in_picture_height_index < MAX_NUMBER_OF_REGIONS_IN_HEIGHT;
+             region_in_picture_height_index < scs->picture_analysis_number_of_regions_per_height;
              region_in_picture_height_index++) {
             svt_memcpy(&(ctx->prev_picture_histogram[region_in_picture_width_index][region_in_picture_height_index][0]),
                        &(pcs->picture_histogram[region_in_picture_width_index][region_in_picture_height_index][0]),
@@ -4621,7 +4655,7 @@ static void assign_and_release_pa_refs(EncodeContext* enc_ctx, PictureParentCont
 }
 
 // Send pictures to TF and ME
-static void process_pics(SequenceControlSet* scs, PictureDecisionContext* ctx) {
+static EbErrorType process_pics(SequenceControlSet* scs, PictureDecisionContext* ctx) {
     PictureParentControlSet* pcs     = NULL; // init'd to quiet build warnings
     const unsigned int       mg_size = ctx->mg_size;
     // Process previous delayed Intra if we have one
@@ -4666,7 +4700,10 @@ static void process_pics(SequenceControlSet* scs, PictureDecisionContext* ctx) {
     if (ctx->prev_delayed_intra) {
         pcs                     = ctx->prev_delayed_intra;
         ctx->prev_delayed_intra = NULL;
-        send_picture_out(scs, pcs, ctx);
+        EbErrorType return_error = send_picture_out(scs, pcs, ctx);
+        if (return_error != EB_ErrorNone) {
+            return return_error;
+        }
     }
 
     //split MG into two for these two special cases
@@ -4704,12 +4741,16 @@ static void process_pics(SequenceControlSet* scs, PictureDecisionContext* ctx) {
                 pcs->ext_mg_id   = ctx->mg_progress_id;
                 pcs->ext_mg_size = 1;
             }
-            pcs->gm_pp_detected = ctx->gm_pp_last_detected;
-            send_picture_out(scs, pcs, ctx);
+            pcs->gm_pp_detected      = ctx->gm_pp_last_detected;
+            EbErrorType return_error = send_picture_out(scs, pcs, ctx);
+            if (return_error != EB_ErrorNone) {
+                return return_error;
+            }
         }
     }
 
     ctx->mg_progress_id++;
+    return EB_ErrorNone;
 }
 
 // update the DPB stored in the PD context
@@ -4990,7 +5031,7 @@ void* svt_aom_picture_decision_kernel(void* input_ptr) {
             // Histogram data to be used at the next input (N + 1)
             // TODO: can this be moved to the end of perform_scene_change_detection? Histograms aren't needed if at EOS
             if (scs->calc_hist) {
-                copy_histograms(pcs, ctx);
+                copy_histograms(scs, pcs, ctx);
             }
 
             // Increment the Pre-Assignment Buffer Intra Count
@@ -5158,6 +5199,8 @@ void* svt_aom_picture_decision_kernel(void* input_ptr) {
                                                      ->is_alt_ref
                         ? 1
                         : 0;
+                    uint32_t       target_bit_rate;
+                    const uint32_t rate_info_id = take_target_bit_rate(enc_ctx, &target_bit_rate);
                     for (pic_idx = ctx->mini_gop_start_index[mini_gop_index];
                          pic_idx <= ctx->mini_gop_end_index[mini_gop_index] + has_overlay;
                          ++pic_idx) {
@@ -5172,6 +5215,8 @@ void* svt_aom_picture_decision_kernel(void* input_ptr) {
                         }
 
                         pcs->picture_number_alt = enc_ctx->picture_number_alt++;
+                        pcs->target_bit_rate    = target_bit_rate;
+                        pcs->rate_info_id       = rate_info_id;
 
                         // Set the Decode Order
                         if ((ctx->mini_gop_idr_count[mini_gop_index] == 0) &&
@@ -5241,7 +5286,13 @@ void* svt_aom_picture_decision_kernel(void* input_ptr) {
                     assign_and_release_pa_refs(enc_ctx, pcs, ctx);
 
                     // Send the pictures in the MG to TF and ME
-                    process_pics(scs, ctx);
+                    const EbErrorType err = process_pics(scs, ctx);
+                    if (err != EB_ErrorNone) {
+                        if (err != EB_NoErrorFifoShutdown) {
+                            enc_ctx->app_callback_ptr->error_handler(enc_ctx->app_callback_ptr->handle, (uint32_t)err);
+                        }
+                        return NULL;
+                    }
                 } // End MINI GOPs loop
                 // Reset the Pre-Assignment Buffer
                 enc_ctx->pre_assignment_buffer_count       = 0;
@@ -865,6 +865,8 @@ int svt_av1_count_colors_highbd(uint16_t* src, int stride, int rows, int cols, i
     const int max_pix_val = 1 << bit_depth;
     // const uint16_t *src = CONVERT_TO_SHORTPTR(src8);
     memset(val_count, 0, max_pix_val * sizeof(val_count[0]));
+    // Count distinct values as they first appear rather than rescanning the whole histogram
+    int n = 0;
     for (int r = 0; r < rows; ++r) {
         for (int c = 0; c < cols; ++c) {
             const int this_val = src[r * stride + c];
@@ -872,13 +874,7 @@ int svt_av1_count_colors_highbd(uint16_t* src, int stride, int rows, int cols, i
             if (this_val >= max_pix_val) {
                 return 0;
             }
-            ++val_count[this_val];
-        }
-    }
-    int n = 0;
-    for (int i = 0; i < max_pix_val; ++i) {
-        if (val_count[i]) {
-            ++n;
+            n += !val_count[this_val]++;
         }
     }
     return n;
@@ -887,17 +883,11 @@ int svt_av1_count_colors_highbd(uint16_t* src, int stride, int rows, int cols, i
 int svt_av1_count_colors(const uint8_t* src, int stride, int rows, int cols, int* val_count) {
     const int max_pix_val = 1 << 8;
     memset(val_count, 0, max_pix_val * sizeof(val_count[0]));
+    int n = 0;
     for (int r = 0; r < rows; ++r) {
+        const uint8_t* row = src + r * stride;
         for (int c = 0; c < cols; ++c) {
-            const int this_val = src[r * stride + c];
-            assert(this_val < max_pix_val);
-            ++val_count[this_val];
-        }
-    }
-    int n = 0;
-    for (int i = 0; i < max_pix_val; ++i) {
-        if (val_count[i]) {
-            ++n;
+            n += !val_count[row[c]]++;
         }
     }
     return n;
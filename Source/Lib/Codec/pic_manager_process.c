@@ -605,7 +605,8 @@ void* svt_aom_picture_manager_kernel(void* input_ptr) {
             if (entry_ppcs->is_ref) {
                 EbObjectWrapper* ref_pic_wrapper;
                 // Get Empty Reference Picture Object
-                svt_get_empty_object(scs->enc_ctx->reference_picture_pool_fifo_ptr, &ref_pic_wrapper);
+                EB_GET_EMPTY_OBJECT(
+                    scs->enc_ctx->reference_picture_pool_fifo_ptr, &ref_pic_wrapper, scs->enc_ctx->app_callback_ptr);
                 entry_ppcs->ref_pic_wrapper = ref_pic_wrapper;
                 // reset reference object in case of its members are altered by superres
                 // tool
@@ -626,7 +627,7 @@ void* svt_aom_picture_manager_kernel(void* input_ptr) {
             }
             // Get New  Empty recon-coef from recon-coef  Pool
             EbObjectWrapper* enc_dec_wrapper;
-            svt_get_empty_object(context_ptr->recon_coef_fifo_ptr, &enc_dec_wrapper);
+            EB_GET_EMPTY_OBJECT(context_ptr->recon_coef_fifo_ptr, &enc_dec_wrapper, scs->enc_ctx->app_callback_ptr);
             // Child PCS is released by Packetization
             svt_object_inc_live_count(enc_dec_wrapper, 1);
             EncDecSet* enc_dec_ptr = (EncDecSet*)enc_dec_wrapper->object_ptr;
@@ -645,7 +646,8 @@ void* svt_aom_picture_manager_kernel(void* input_ptr) {
 
             // Get New  Empty Child PCS from PCS Pool
             EbObjectWrapper* child_pcs_wrapper;
-            svt_get_empty_object(context_ptr->picture_control_set_fifo_ptr, &child_pcs_wrapper);
+            EB_GET_EMPTY_OBJECT(
+                context_ptr->picture_control_set_fifo_ptr, &child_pcs_wrapper, scs->enc_ctx->app_callback_ptr);
 
             // Child PCS is released by Packetization
             svt_object_inc_live_count(child_pcs_wrapper, 1);
@@ -59,11 +59,15 @@ static int is_better_motion(const RANSAC_MOTION* motion_a, const RANSAC_MOTION*
     return compare_motions(motion_a, motion_b) < 0;
 }
 
-static void score_translation(const double* mat, const Correspondence* points, int num_points, RANSAC_MOTION* model) {
+static void score_translation(const double* mat, const Correspondence* points, int num_points, int min_inliers,
+                              RANSAC_MOTION* model) {
     model->num_inliers = 0;
     model->sse         = 0.0;
 
     for (int i = 0; i < num_points; ++i) {
+        if (model->num_inliers + num_points - i < min_inliers) {
+            return;
+        }
         const double x1 = points[i].x;
         const double y1 = points[i].y;
         const double x2 = points[i].rx;
@@ -83,11 +87,15 @@ static void score_translation(const double* mat, const Correspondence* points, i
     }
 }
 
-static void score_affine(const double* mat, const Correspondence* points, int num_points, RANSAC_MOTION* model) {
+static void score_affine(const double* mat, const Correspondence* points, int num_points, int min_inliers,
+                         RANSAC_MOTION* model) {
     model->num_inliers = 0;
     model->sse         = 0.0;
 
     for (int i = 0; i < num_points; ++i) {
+        if (model->num_inliers + num_points - i < min_inliers) {
+            return;
+        }
         const double x1 = points[i].x;
         const double y1 = points[i].y;
         const double x2 = points[i].rx;
@@ -297,7 +305,13 @@ static bool ransac_internal(const Correspondence* matched_points, int npoints, M
             continue;
         }
 
-        model_info->score_model(params_this_motion, matched_points, npoints, &current_motion);
+        // A trial is only kept if it reaches min_inliers and ties or beats the worst kept motion, so scoring
+        // can give up once the remaining points cannot get it there
+        model_info->score_model(params_this_motion,
+                                matched_points,
+                                npoints,
+                                AOMMAX(min_inliers, worst_kept_motion->num_inliers),
+                                &current_motion);
 
         if (current_motion.num_inliers < min_inliers) {
             // Reject models with too few inliers
@@ -366,7 +380,7 @@ static bool ransac_internal(const Correspondence* matched_points, int npoints, M
             }
 
             // Score the newly generated model
-            model_info->score_model(params_this_motion, matched_points, npoints, &current_motion);
+            model_info->score_model(params_this_motion, matched_points, npoints, 0, &current_motion);
 
             // At this point, there are three possibilities:
             // 1) If we found more inliers, keep refining.
@@ -31,7 +31,9 @@ typedef struct {
 
 typedef bool (*FindTransformationFunc)(const Correspondence* points, const int* indices, int num_indices,
                                        double* params);
-typedef void (*ScoreModelFunc)(const double* mat, const Correspondence* points, int num_points, RANSAC_MOTION* model);
+// Scoring stops as soon as the model can no longer reach min_inliers, leaving num_inliers below it
+typedef void (*ScoreModelFunc)(const double* mat, const Correspondence* points, int num_points, int min_inliers,
+                               RANSAC_MOTION* model);
 
 // vtable-like structure which stores all of the information needed by RANSAC
 // for a particular model type
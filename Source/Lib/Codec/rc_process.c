@@ -600,6 +600,23 @@ void reset_rc_param(PictureParentControlSet* ppcs) {
     ppcs->undershoot_seen = 0;
 }
 
+/******************************************************
+ * rc_update_rate_info
+ * Applies the target bit rate requested with svt_av1_enc_update_rate_info() when the first
+ * picture of the mini-GOP it was taken by reaches rate control. All the pictures of the
+ * mini-GOP carry the request, its id makes sure it is applied once and never undone.
+ * Only rate control reads the target, the other rate changes go through a new scs.
+ ******************************************************/
+static void rc_update_rate_info(PictureParentControlSet* ppcs) {
+    SequenceControlSet* scs     = ppcs->scs;
+    EncodeContext*      enc_ctx = scs->enc_ctx;
+    if (ppcs->rate_info_id <= enc_ctx->rate_info_applied_id) {
+        return;
+    }
+    enc_ctx->rate_info_applied_id = ppcs->rate_info_id;
+    svt_av1_rc_update_target_rate(scs, ppcs->target_bit_rate);
+}
+
 /******************************************************
  * rc_init_frame_stats
  * Initializes frame statistics for rate control:
@@ -826,6 +843,7 @@ void* svt_aom_rate_control_kernel(void* input_ptr) {
             ppcs = pcs->ppcs;
             scs  = pcs->scs;
 
+            rc_update_rate_info(ppcs);
             rc_init_frame_stats(pcs, scs);
 
             if (!is_superres_recode_task) {
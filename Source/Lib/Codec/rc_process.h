@@ -251,6 +251,7 @@ void svt_av1_rc_process_rate_allocation(struct PictureControlSet* pcs, struct Se
 void svt_av1_rc_calc_qindex_rate_control(struct PictureControlSet* pcs, struct SequenceControlSet* scs);
 void svt_av1_rc_postencode_update_gop_const(struct PictureParentControlSet* ppcs);
 void svt_av1_rc_postencode_update(struct PictureParentControlSet* ppcs);
+void svt_av1_rc_update_target_rate(struct SequenceControlSet* scs, uint32_t target_bit_rate);
 
 // common stuff
 void    svt_av1_rc_init(struct SequenceControlSet* scs);
@@ -677,6 +677,22 @@ static void set_rc_buffer_sizes(SequenceControlSet* scs) {
     rc->maximum_buffer_size   = (maximum == 0) ? bandwidth / 8 : maximum * bandwidth / 1000;
 }
 
+/******************************************************
+ * svt_av1_rc_update_target_rate
+ * Switches the target bit rate of a running CBR stream without resetting the rate control:
+ * the buffer model is rescaled to the new rate and its fullness clamped to the new size
+ ******************************************************/
+void svt_av1_rc_update_target_rate(SequenceControlSet* scs, uint32_t target_bit_rate) {
+    RATE_CONTROL* rc = &scs->enc_ctx->rc;
+
+    scs->static_config.target_bit_rate = target_bit_rate;
+    set_rc_buffer_sizes(scs);
+    rc->bits_off_target = AOMMIN(rc->bits_off_target, rc->maximum_buffer_size);
+    rc->buffer_level    = AOMMIN(rc->buffer_level, rc->maximum_buffer_size);
+    // per frame bandwidth
+    svt_av1_new_framerate(scs, scs->new_framerate);
+}
+
 #define MIN_BOOST_COMBINE_FACTOR 4.0
 
 /******************************************************************************
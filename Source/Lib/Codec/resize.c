@@ -1482,9 +1482,16 @@ void scale_pcs_params(SequenceControlSet* scs, PictureParentControlSet* pcs, sup
 
     svt_aom_derive_input_resolution(&pcs->input_resolution, spr_params.encoding_width * spr_params.encoding_height);
 
-    // create new picture level sb_params and sb_geom
-    b64_geom_init(scs, pcs->aligned_width, pcs->aligned_height, &pcs->b64_geom);
-    sb_geom_init(scs, pcs->aligned_width, pcs->aligned_height, &pcs->sb_geom);
+    // create new picture level sb_params and sb_geom. The picture's own arrays are sized for the full resolution
+    // (see realloc_sb_param()), so a picture that is not larger refills them in place.
+    if (pcs->is_pcs_sb_params && pcs->b64_total_count <= scs->b64_total_count &&
+        picture_sb_width * picture_sb_height <= scs->picture_width_in_sb * scs->picture_height_in_sb) {
+        b64_geom_fill(scs, pcs->aligned_width, pcs->aligned_height, pcs->b64_geom);
+        sb_geom_fill(scs, pcs->aligned_width, pcs->aligned_height, pcs->sb_geom);
+    } else {
+        b64_geom_init(scs, pcs->aligned_width, pcs->aligned_height, &pcs->b64_geom);
+        sb_geom_init(scs, pcs->aligned_width, pcs->aligned_height, &pcs->sb_geom);
+    }
 
     if (pcs->frame_superres_enabled == true || pcs->frame_resize_enabled == true) {
         pcs->frm_hdr.use_ref_frame_mvs = 0;
@@ -1847,9 +1854,7 @@ void svt_aom_reset_resized_picture(SequenceControlSet* scs, PictureParentControl
     pcs->render_height              = input_pic->height;
     // restore frame size (width) which was changed by super-res tool
     scale_pcs_params(scs, pcs, spr_params, input_pic->width, input_pic->height);
-    // delete picture buffer allocated by super-res tool
-    // TODO: reuse the buffer if current picture's denominator is the same as previous one's.
-    EB_DELETE(pcs->enhanced_downscaled_pic);
+    // the picture buffer allocated by the scaling tools is kept for the next scaled picture using this pcs
 }
 
 static uint8_t calculate_next_resize_scale(const SequenceControlSet* scs, const PictureParentControlSet* pcs) {
@@ -2040,10 +2045,6 @@ void svt_aom_init_resize_picture(SequenceControlSet* scs, PictureParentControlSe
 
     // step 3: resize source picture to downscaled picture
 
-    // delete picture buffer allocated by superres tool
-    // TODO: reuse the buffer if current picture's denom is the same as previous one's.
-    EB_DELETE(pcs->enhanced_downscaled_pic);
-
     if (spr_params.encoding_width != input_pic->width || spr_params.encoding_height != input_pic->height) {
         do_resize = true;
     }
@@ -2054,8 +2055,15 @@ void svt_aom_init_resize_picture(SequenceControlSet* scs, PictureParentControlSe
     }
 
     if (do_resize) {
-        // Allocate downsampled picture buffer descriptor
-        svt_aom_downscaled_source_buffer_desc_ctor(&pcs->enhanced_downscaled_pic, input_pic, spr_params);
+        // Reuse the downsampled picture buffer of the previous scaled picture that used this pcs if the size is the
+        // same, otherwise allocate one
+        if (pcs->enhanced_downscaled_pic && (pcs->enhanced_downscaled_pic->width != spr_params.encoding_width ||
+                                             pcs->enhanced_downscaled_pic->height != spr_params.encoding_height)) {
+            EB_DELETE(pcs->enhanced_downscaled_pic);
+        }
+        if (pcs->enhanced_downscaled_pic == NULL) {
+            svt_aom_downscaled_source_buffer_desc_ctor(&pcs->enhanced_downscaled_pic, input_pic, spr_params);
+        }
 
         const int32_t  num_planes = av1_num_planes(&scs->seq_header.color_config);
         const uint32_t ss_x       = scs->subsampling_x;
@@ -28,6 +28,7 @@
 #include "common_dsp_rtcd.h"
 #include "metadata_handle.h"
 #include "enc_mode_config.h"
+#include "packetization_process.h"
 
 typedef struct ResourceCoordinationContext {
     EbFifo*                       input_cmd_fifo_ptr;
@@ -764,6 +765,21 @@ static void update_rate_info(ResourceCoordinationContext* ctx, EbBufferHeaderTyp
         }
         node = node->next;
     }
+    // The sequence QP and max bit rate requested with svt_av1_enc_update_rate_info() are read from the scs
+    // by every process, they go through a new scs like the RATE_CHANGE_EVENT changes
+    EncodeContext* enc_ctx = ctx->scs_instance->enc_ctx;
+    svt_block_on_mutex(enc_ctx->rate_info_mutex);
+    if (enc_ctx->rate_info.seq_qp != 0) {
+        scs->static_config.qp     = enc_ctx->rate_info.seq_qp;
+        enc_ctx->rate_info.seq_qp = 0;
+        ctx->seq_param_change     = true;
+    }
+    if (enc_ctx->rate_info.max_bit_rate != 0) {
+        scs->static_config.max_bit_rate = enc_ctx->rate_info.max_bit_rate;
+        enc_ctx->rate_info.max_bit_rate = 0;
+        ctx->seq_param_change           = true;
+    }
+    svt_release_mutex(enc_ctx->rate_info_mutex);
 }
 
 // Update the target rate, sequence QP...
@@ -837,7 +853,7 @@ static void set_eos_terminating_signals(PictureParentControlSet* pcs) {
         tmp_out_str->flags        = EB_BUFFERFLAG_EOS;
         tmp_out_str->n_filled_len = 0;
 
-        svt_post_full_object(tmp_out_str_wrp);
+        svt_aom_post_output_stream(enc_ctx->app_callback_ptr, tmp_out_str_wrp);
 
         // if applicable, also need to signal recon EOS
         if (scs->static_config.recon_enabled) {
@@ -1021,7 +1037,8 @@ void* svt_aom_resource_coordination_kernel(void* input_ptr) {
             : 1;
         for (uint8_t loop_index = 0; loop_index <= has_overlay && !end_of_sequence_flag; loop_index++) {
             // Get a New ParentPCS where we will hold the new input_picture
-            svt_get_empty_object(context_ptr->picture_control_set_fifo_ptr, &pcs_wrapper);
+            EB_GET_EMPTY_OBJECT(
+                context_ptr->picture_control_set_fifo_ptr, &pcs_wrapper, scs->enc_ctx->app_callback_ptr);
 
             // Parent PCS is released by the Rate Control after passing through
             // MDC->MD->ENCDEC->Packetization
@@ -1201,7 +1218,8 @@ void* svt_aom_resource_coordination_kernel(void* input_ptr) {
             pcs->sframe_ref_pruned        = false;
 
             // Get Empty Reference Picture Object
-            svt_get_empty_object(scs->enc_ctx->pa_reference_picture_pool_fifo_ptr, &ref_pic_wrapper);
+            EB_GET_EMPTY_OBJECT(
+                scs->enc_ctx->pa_reference_picture_pool_fifo_ptr, &ref_pic_wrapper, scs->enc_ctx->app_callback_ptr);
 
             pcs->pa_ref_pic_wrapper = ref_pic_wrapper;
             // make pa_ref full sample buffer access the luma8bit part from the y8b Pool
@@ -30,6 +30,7 @@ typedef struct RestContext {
     EbDctor dctor;
     EbFifo* rest_input_fifo_ptr;
     EbFifo* rest_output_fifo_ptr;
+    EbFifo* rest_helper_fifo_ptr; // posts the filter application helper tasks back to the rest processes
     EbFifo* picture_demux_fifo_ptr;
 
     EbPictureBufferDesc* trial_frame_rst;
@@ -84,6 +85,8 @@ EbErrorType svt_aom_rest_context_ctor(EbThreadContext* thread_ctx, const EbEncHa
                                                                              index);
     context_ptr->rest_output_fifo_ptr = svt_system_resource_get_producer_fifo(enc_handle_ptr->rest_results_resource_ptr,
                                                                               index);
+    context_ptr->rest_helper_fifo_ptr = svt_system_resource_get_producer_fifo(
+        enc_handle_ptr->cdef_results_resource_ptr, scs->cdef_process_init_count + index);
     context_ptr->picture_demux_fifo_ptr = svt_system_resource_get_producer_fifo(
         enc_handle_ptr->picture_demux_results_resource_ptr, demux_index);
 
@@ -249,6 +252,177 @@ static void copy_statistics_to_ref_obj_ect(PictureControlSet* pcs, SequenceContr
     }
 }
 
+// Work done once per picture after the restoration filter has been applied: padding the reference, recon output,
+// PSNR/SSIM, and posting the picture to the next stages. Called with rest_search_mutex held.
+static void rest_finish_picture(RestContext* context_ptr, PictureControlSet* pcs, EbObjectWrapper* pcs_wrapper) {
+    PictureParentControlSet* ppcs     = pcs->ppcs;
+    SequenceControlSet*      scs      = pcs->scs;
+    bool                     is_16bit = scs->is_16bit_pipeline;
+
+    // delete scaled_input_pic after lr finished
+    EB_DELETE(pcs->scaled_input_pic);
+    if (ppcs->ref_pic_wrapper != NULL) {
+        // copy stat to ref object (intra_coded_area, Luminance, Scene change detection
+        // flags)
+        copy_statistics_to_ref_obj_ect(pcs, scs);
+    }
+
+    bool superres_recode = ppcs->superres_total_recode_loop > 0 ? true : false;
+
+    // Pad the reference picture and set ref POC
+    {
+        if (ppcs->is_ref == true) {
+            pad_ref_and_set_flags(pcs, scs);
+        } else {
+            // convert non-reference frame buffer from 16-bit to 8-bit, to export recon and
+            // psnr/ssim calculation
+            if (is_16bit && scs->static_config.encoder_bit_depth == EB_EIGHT_BIT) {
+                EbPictureBufferDesc* ref_pic_ptr       = ppcs->enc_dec_ptr->recon_pic;
+                EbPictureBufferDesc* ref_pic_16bit_ptr = ppcs->enc_dec_ptr->recon_pic_16bit;
+                // Y
+                uint16_t* buf_16bit = (uint16_t*)(ref_pic_16bit_ptr->y_buffer) -
+                    (ref_pic_16bit_ptr->border + (ref_pic_16bit_ptr->border * ref_pic_16bit_ptr->y_stride));
+                uint8_t* buf_8bit = ref_pic_ptr->y_buffer -
+                    (ref_pic_ptr->border + (ref_pic_ptr->border * ref_pic_ptr->y_stride));
+                svt_convert_16bit_to_8bit(buf_16bit,
+                                          ref_pic_16bit_ptr->y_stride,
+                                          buf_8bit,
+                                          ref_pic_ptr->y_stride,
+                                          ref_pic_16bit_ptr->width + (ref_pic_ptr->border << 1),
+                                          ref_pic_16bit_ptr->height + (ref_pic_ptr->border << 1));
+
+                //CB
+                buf_16bit = (uint16_t*)(ref_pic_16bit_ptr->u_buffer) -
+                    ((ref_pic_16bit_ptr->border >> scs->subsampling_x) +
+                     ((ref_pic_16bit_ptr->border >> scs->subsampling_y) * ref_pic_16bit_ptr->u_stride));
+                buf_8bit = ref_pic_ptr->u_buffer -
+                    ((ref_pic_ptr->border >> scs->subsampling_x) +
+                     ((ref_pic_ptr->border >> scs->subsampling_y) * ref_pic_ptr->u_stride));
+                svt_convert_16bit_to_8bit(
+                    buf_16bit,
+                    ref_pic_16bit_ptr->u_stride,
+                    buf_8bit,
+                    ref_pic_ptr->u_stride,
+                    (ref_pic_16bit_ptr->width + (ref_pic_ptr->border << 1)) >> scs->subsampling_x,
+                    (ref_pic_16bit_ptr->height + (ref_pic_ptr->border << 1)) >> scs->subsampling_y);
+
+                //CR
+                buf_16bit = (uint16_t*)(ref_pic_16bit_ptr->v_buffer) -
+                    ((ref_pic_16bit_ptr->border >> scs->subsampling_x) +
+                     ((ref_pic_16bit_ptr->border >> scs->subsampling_y) * ref_pic_16bit_ptr->v_stride));
+                buf_8bit = ref_pic_ptr->v_buffer -
+                    ((ref_pic_ptr->border >> scs->subsampling_x) +
+                     ((ref_pic_ptr->border >> scs->subsampling_y) * ref_pic_ptr->v_stride));
+                svt_convert_16bit_to_8bit(
+                    buf_16bit,
+                    ref_pic_16bit_ptr->v_stride,
+                    buf_8bit,
+                    ref_pic_ptr->v_stride,
+                    (ref_pic_16bit_ptr->width + (ref_pic_ptr->border << 1)) >> scs->subsampling_x,
+                    (ref_pic_16bit_ptr->height + (ref_pic_ptr->border << 1)) >> scs->subsampling_y);
+            }
+        }
+    }
+
+    // PSNR and SSIM Calculation.
+    if (superres_recode) { // superres needs psnr to compute rdcost
+        // Note: if superres recode is actived, memory needs to be freed in packetization process by calling free_temporal_filtering_buffer()
+        EbErrorType return_error = psnr_calculations(pcs, scs, false);
+        if (return_error != EB_ErrorNone) {
+            svt_aom_assert_err(0,
+                               "Couldn't allocate memory for uncompressed 10bit buffers for PSNR "
+                               "calculations");
+        }
+    } else {
+        EbErrorType return_error = EB_ErrorNone;
+        if (pcs->ppcs->compute_psnr) {
+            // Note: if temporal_filtering is used, memory needs to be freed in the last of these calls
+            return_error = psnr_calculations(pcs, scs, !pcs->ppcs->compute_ssim);
+            if (return_error != EB_ErrorNone) {
+                svt_aom_assert_err(0,
+                                   "Couldn't allocate memory for uncompressed 10bit buffers for PSNR "
+                                   "calculations");
+            }
+        }
+        if (pcs->ppcs->compute_ssim) {
+            return_error = svt_aom_ssim_calculations(pcs, scs, true /* free memory here */);
+            if (return_error != EB_ErrorNone) {
+                svt_aom_assert_err(0,
+                                   "Couldn't allocate memory for uncompressed 10bit buffers for SSIM "
+                                   "calculations");
+            }
+        }
+    }
+
+    if (!superres_recode) {
+        if (scs->static_config.recon_enabled) {
+            svt_aom_recon_output(pcs, scs);
+        }
+        // post reference picture task in packetization process if it's superres_recode
+        if (ppcs->is_ref) {
+            // Get Empty PicMgr Results
+            EbObjectWrapper* picture_demux_results_wrapper_ptr;
+            svt_get_empty_object(context_ptr->picture_demux_fifo_ptr, &picture_demux_results_wrapper_ptr);
+
+            PictureDemuxResults* picture_demux_results_rtr = (PictureDemuxResults*)
+                                                                 picture_demux_results_wrapper_ptr->object_ptr;
+            picture_demux_results_rtr->ref_pic_wrapper = ppcs->ref_pic_wrapper;
+            picture_demux_results_rtr->scs             = pcs->scs;
+            picture_demux_results_rtr->picture_number  = pcs->picture_number;
+            picture_demux_results_rtr->picture_type    = EB_PIC_REFERENCE;
+
+            // Post Reference Picture
+            svt_post_full_object(picture_demux_results_wrapper_ptr);
+        }
+    }
+
+    int tile_cols = ppcs->av1_cm->tiles_info.tile_cols;
+    int tile_rows = ppcs->av1_cm->tiles_info.tile_rows;
+
+    for (int tile_row_idx = 0; tile_row_idx < tile_rows; tile_row_idx++) {
+        for (int tile_col_idx = 0; tile_col_idx < tile_cols; tile_col_idx++) {
+            const int        tile_idx = tile_row_idx * tile_cols + tile_col_idx;
+            EbObjectWrapper* rest_results_wrapper;
+            svt_get_empty_object(context_ptr->rest_output_fifo_ptr, &rest_results_wrapper);
+            RestResults* rest_results = (RestResults*)rest_results_wrapper->object_ptr;
+            rest_results->pcs_wrapper = pcs_wrapper;
+            rest_results->tile_index  = tile_idx;
+            // Post Rest Results
+            svt_post_full_object(rest_results_wrapper);
+        }
+    }
+}
+
+// Run (plane, restoration unit row) filter jobs until none are left. The thread that leaves last, once every job is
+// done, copies the filtered planes back and finishes the picture.
+static void rest_apply_filter(RestContext* context_ptr, PictureControlSet* pcs, EbObjectWrapper* pcs_wrapper) {
+    SequenceControlSet* scs      = pcs->scs;
+    Av1Common*          cm       = pcs->ppcs->av1_cm;
+    bool                is_16bit = scs->is_16bit_pipeline;
+
+    // Jobs run concurrently, so each filters from its own copy of the rows it reads (see
+    // svt_av1_loop_restoration_filter_unit_row()). The trial frame is free outside the search.
+    Yv12BufferConfig scratch;
+    svt_aom_link_eb_to_aom_buffer_desc(
+        context_ptr->trial_frame_rst, &scratch, scs->max_input_pad_right, scs->max_input_pad_bottom, is_16bit);
+
+    svt_block_on_mutex(pcs->rest_search_mutex);
+    while (pcs->rest_apply_next_row < pcs->rest_apply_unit_rows) {
+        const uint32_t unit_row = pcs->rest_apply_next_row++;
+        svt_release_mutex(pcs->rest_search_mutex);
+        svt_av1_loop_restoration_filter_unit_row(context_ptr->rst_tmpbuf, cm->frame_to_show, &scratch, cm, unit_row);
+        svt_block_on_mutex(pcs->rest_search_mutex);
+    }
+    // The finishing search thread and every helper task take part
+    if (++pcs->rest_apply_threads_done == pcs->rest_apply_helpers + 1) {
+        if (pcs->rest_apply_unit_rows) {
+            svt_av1_loop_restoration_filter_frame_finish(cm->frame_to_show, cm);
+        }
+        rest_finish_picture(context_ptr, pcs, pcs_wrapper);
+    }
+    svt_release_mutex(pcs->rest_search_mutex);
+}
+
 /******************************************************
  * Rest Kernel
  ******************************************************/
@@ -268,6 +442,12 @@ void* svt_aom_rest_kernel(void* input_ptr) {
         FrameHeader*             frm_hdr      = &ppcs->frm_hdr;
         bool                     is_16bit     = scs->is_16bit_pipeline;
         Av1Common*               cm           = ppcs->av1_cm;
+        if (cdef_results->segment_index >= pcs->rest_segments_total_count) {
+            // Helper task: share the filter application
+            rest_apply_filter(context_ptr, pcs, cdef_results->pcs_wrapper);
+            svt_release_object(cdef_results_wrapper);
+            continue;
+        }
         if (ppcs->enable_restoration && frm_hdr->allow_intrabc == 0) {
             // If using boundaries during the filter search, copy the recon pic to a new buffer (to
             // avoid race condition from many threads modifying the same recon pic).
@@ -332,16 +512,15 @@ void* svt_aom_rest_kernel(void* input_ptr) {
 
         pcs->tot_seg_searched_rest++;
         if (pcs->tot_seg_searched_rest == pcs->rest_segments_total_count) {
+            bool apply = false;
             if (ppcs->enable_restoration && frm_hdr->allow_intrabc == 0) {
                 rest_finish_search(pcs);
 
                 // Only need recon if REF pic or recon is output
                 if (ppcs->is_ref || scs->static_config.recon_enabled) {
-                    if (pcs->rst_info[0].frame_restoration_type != RESTORE_NONE ||
+                    apply = pcs->rst_info[0].frame_restoration_type != RESTORE_NONE ||
                         pcs->rst_info[1].frame_restoration_type != RESTORE_NONE ||
-                        pcs->rst_info[2].frame_restoration_type != RESTORE_NONE) {
-                        svt_av1_loop_restoration_filter_frame(context_ptr->rst_tmpbuf, cm->frame_to_show, cm, 0);
-                    }
+                        pcs->rst_info[2].frame_restoration_type != RESTORE_NONE;
                 }
             } else {
                 pcs->rst_info[0].frame_restoration_type = RESTORE_NONE;
@@ -349,138 +528,31 @@ void* svt_aom_rest_kernel(void* input_ptr) {
                 pcs->rst_info[2].frame_restoration_type = RESTORE_NONE;
             }
 
-            // delete scaled_input_pic after lr finished
-            EB_DELETE(pcs->scaled_input_pic);
-            if (ppcs->ref_pic_wrapper != NULL) {
-                // copy stat to ref object (intra_coded_area, Luminance, Scene change detection
-                // flags)
-                copy_statistics_to_ref_obj_ect(pcs, scs);
-            }
-
-            bool superres_recode = ppcs->superres_total_recode_loop > 0 ? true : false;
-
-            // Pad the reference picture and set ref POC
-            {
-                if (ppcs->is_ref == true) {
-                    pad_ref_and_set_flags(pcs, scs);
-                } else {
-                    // convert non-reference frame buffer from 16-bit to 8-bit, to export recon and
-                    // psnr/ssim calculation
-                    if (is_16bit && scs->static_config.encoder_bit_depth == EB_EIGHT_BIT) {
-                        EbPictureBufferDesc* ref_pic_ptr       = ppcs->enc_dec_ptr->recon_pic;
-                        EbPictureBufferDesc* ref_pic_16bit_ptr = ppcs->enc_dec_ptr->recon_pic_16bit;
-                        // Y
-                        uint16_t* buf_16bit = (uint16_t*)(ref_pic_16bit_ptr->y_buffer) -
-                            (ref_pic_16bit_ptr->border + (ref_pic_16bit_ptr->border * ref_pic_16bit_ptr->y_stride));
-                        uint8_t* buf_8bit = ref_pic_ptr->y_buffer -
-                            (ref_pic_ptr->border + (ref_pic_ptr->border * ref_pic_ptr->y_stride));
-                        svt_convert_16bit_to_8bit(buf_16bit,
-                                                  ref_pic_16bit_ptr->y_stride,
-                                                  buf_8bit,
-                                                  ref_pic_ptr->y_stride,
-                                                  ref_pic_16bit_ptr->width + (ref_pic_ptr->border << 1),
-                                                  ref_pic_16bit_ptr->height + (ref_pic_ptr->border << 1));
-
-                        //CB
-                        buf_16bit = (uint16_t*)(ref_pic_16bit_ptr->u_buffer) -
-                            ((ref_pic_16bit_ptr->border >> scs->subsampling_x) +
-                             ((ref_pic_16bit_ptr->border >> scs->subsampling_y) * ref_pic_16bit_ptr->u_stride));
-                        buf_8bit = ref_pic_ptr->u_buffer -
-                            ((ref_pic_ptr->border >> scs->subsampling_x) +
-                             ((ref_pic_ptr->border >> scs->subsampling_y) * ref_pic_ptr->u_stride));
-                        svt_convert_16bit_to_8bit(
-                            buf_16bit,
-                            ref_pic_16bit_ptr->u_stride,
-                            buf_8bit,
-                            ref_pic_ptr->u_stride,
-                            (ref_pic_16bit_ptr->width + (ref_pic_ptr->border << 1)) >> scs->subsampling_x,
-                            (ref_pic_16bit_ptr->height + (ref_pic_ptr->border << 1)) >> scs->subsampling_y);
-
-                        //CR
-                        buf_16bit = (uint16_t*)(ref_pic_16bit_ptr->v_buffer) -
-                            ((ref_pic_16bit_ptr->border >> scs->subsampling_x) +
-                             ((ref_pic_16bit_ptr->border >> scs->subsampling_y) * ref_pic_16bit_ptr->v_stride));
-                        buf_8bit = ref_pic_ptr->v_buffer -
-                            ((ref_pic_ptr->border >> scs->subsampling_x) +
-                             ((ref_pic_ptr->border >> scs->subsampling_y) * ref_pic_ptr->v_stride));
-                        svt_convert_16bit_to_8bit(
-                            buf_16bit,
-                            ref_pic_16bit_ptr->v_stride,
-                            buf_8bit,
-                            ref_pic_ptr->v_stride,
-                            (ref_pic_16bit_ptr->width + (ref_pic_ptr->border << 1)) >> scs->subsampling_x,
-                            (ref_pic_16bit_ptr->height + (ref_pic_ptr->border << 1)) >> scs->subsampling_y);
-                    }
-                }
-            }
-
-            // PSNR and SSIM Calculation.
-            if (superres_recode) { // superres needs psnr to compute rdcost
-                // Note: if superres recode is actived, memory needs to be freed in packetization process by calling free_temporal_filtering_buffer()
-                EbErrorType return_error = psnr_calculations(pcs, scs, false);
-                if (return_error != EB_ErrorNone) {
-                    svt_aom_assert_err(0,
-                                       "Couldn't allocate memory for uncompressed 10bit buffers for PSNR "
-                                       "calculations");
-                }
-            } else {
-                EbErrorType return_error = EB_ErrorNone;
-                if (pcs->ppcs->compute_psnr) {
-                    // Note: if temporal_filtering is used, memory needs to be freed in the last of these calls
-                    return_error = psnr_calculations(pcs, scs, !pcs->ppcs->compute_ssim);
-                    if (return_error != EB_ErrorNone) {
-                        svt_aom_assert_err(0,
-                                           "Couldn't allocate memory for uncompressed 10bit buffers for PSNR "
-                                           "calculations");
-                    }
-                }
-                if (pcs->ppcs->compute_ssim) {
-                    return_error = svt_aom_ssim_calculations(pcs, scs, true /* free memory here */);
-                    if (return_error != EB_ErrorNone) {
-                        svt_aom_assert_err(0,
-                                           "Couldn't allocate memory for uncompressed 10bit buffers for SSIM "
-                                           "calculations");
-                    }
-                }
-            }
-
-            if (!superres_recode) {
-                if (scs->static_config.recon_enabled) {
-                    svt_aom_recon_output(pcs, scs);
-                }
-                // post reference picture task in packetization process if it's superres_recode
-                if (ppcs->is_ref) {
-                    // Get Empty PicMgr Results
-                    EbObjectWrapper* picture_demux_results_wrapper_ptr;
-                    svt_get_empty_object(context_ptr->picture_demux_fifo_ptr, &picture_demux_results_wrapper_ptr);
-
-                    PictureDemuxResults* picture_demux_results_rtr = (PictureDemuxResults*)
-                                                                         picture_demux_results_wrapper_ptr->object_ptr;
-                    picture_demux_results_rtr->ref_pic_wrapper = ppcs->ref_pic_wrapper;
-                    picture_demux_results_rtr->scs             = pcs->scs;
-                    picture_demux_results_rtr->picture_number  = pcs->picture_number;
-                    picture_demux_results_rtr->picture_type    = EB_PIC_REFERENCE;
-
-                    // Post Reference Picture
-                    svt_post_full_object(picture_demux_results_wrapper_ptr);
+            if (apply && scs->rest_process_init_count > 1) {
+                // The other rest processes help apply the filter: one helper task per extra process, up to one per
+                // (plane, restoration unit row) job. They are posted only now, so that they find the jobs ready.
+                const uint32_t unit_rows     = svt_av1_loop_restoration_filter_frame_init(cm->frame_to_show, cm, 0);
+                pcs->rest_apply_unit_rows    = unit_rows;
+                pcs->rest_apply_next_row     = 0;
+                pcs->rest_apply_threads_done = 0;
+                pcs->rest_apply_helpers      = (uint16_t)MIN(scs->rest_process_init_count - 1, unit_rows - 1);
+                svt_release_mutex(pcs->rest_search_mutex);
+                for (uint16_t i = 0; i < pcs->rest_apply_helpers; ++i) {
+                    EbObjectWrapper* helper_wrapper;
+                    svt_get_empty_object(context_ptr->rest_helper_fifo_ptr, &helper_wrapper);
+                    CdefResults* helper   = (CdefResults*)helper_wrapper->object_ptr;
+                    helper->pcs_wrapper   = cdef_results->pcs_wrapper;
+                    helper->segment_index = pcs->rest_segments_total_count;
+                    svt_post_full_object(helper_wrapper);
                 }
+                rest_apply_filter(context_ptr, pcs, cdef_results->pcs_wrapper);
+                svt_release_object(cdef_results_wrapper);
+                continue;
             }
-
-            int tile_cols = ppcs->av1_cm->tiles_info.tile_cols;
-            int tile_rows = ppcs->av1_cm->tiles_info.tile_rows;
-
-            for (int tile_row_idx = 0; tile_row_idx < tile_rows; tile_row_idx++) {
-                for (int tile_col_idx = 0; tile_col_idx < tile_cols; tile_col_idx++) {
-                    const int        tile_idx = tile_row_idx * tile_cols + tile_col_idx;
-                    EbObjectWrapper* rest_results_wrapper;
-                    svt_get_empty_object(context_ptr->rest_output_fifo_ptr, &rest_results_wrapper);
-                    RestResults* rest_results = (RestResults*)rest_results_wrapper->object_ptr;
-                    rest_results->pcs_wrapper = cdef_results->pcs_wrapper;
-                    rest_results->tile_index  = tile_idx;
-                    // Post Rest Results
-                    svt_post_full_object(rest_results_wrapper);
-                }
+            if (apply) {
+                svt_av1_loop_restoration_filter_frame(context_ptr->rst_tmpbuf, cm->frame_to_show, cm, 0);
             }
+            rest_finish_picture(context_ptr, pcs, cdef_results->pcs_wrapper);
         }
         svt_release_mutex(pcs->rest_search_mutex);
 
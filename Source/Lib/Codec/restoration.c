@@ -1121,12 +1121,6 @@ typedef struct {
     int32_t*                tmpbuf;
 } FilterFrameCtxt;
 
-static void filter_frame_on_tile(int32_t tile_row, int32_t tile_col, void* priv) {
-    (void)tile_col;
-    FilterFrameCtxt* ctxt = (FilterFrameCtxt*)priv;
-    ctxt->tile_stripe0    = (tile_row == 0) ? 0 : ctxt->cm->child_pcs->rst_end_stripe[tile_row - 1];
-}
-
 static void filter_frame_on_unit(const RestorationTileLimits* limits, const Av1PixelRect* tile_rect,
                                  int32_t rest_unit_idx, void* priv) {
     FilterFrameCtxt*       ctxt = (FilterFrameCtxt*)priv;
@@ -1151,13 +1145,9 @@ static void filter_frame_on_unit(const RestorationTileLimits* limits, const Av1P
                                          rsi->optimized_lr);
 }
 
-void svt_av1_loop_restoration_filter_frame(int32_t* rst_tmpbuf, Yv12BufferConfig* frame, Av1Common* cm,
-                                           int32_t optimized_lr) {
+uint32_t svt_av1_loop_restoration_filter_frame_init(Yv12BufferConfig* frame, Av1Common* cm, int32_t optimized_lr) {
     // assert(!cm->all_lossless);
     const int32_t num_planes = 3; // av1_num_planes(cm);
-    typedef void (*CopyFun)(const Yv12BufferConfig* src, Yv12BufferConfig* dst);
-    static const CopyFun copy_funs[3] = {
-        svt_aom_yv12_copy_y_c, svt_aom_yv12_copy_u_c, svt_aom_yv12_copy_v_c}; //CHKN SSE
 
     Yv12BufferConfig* dst = &cm->rst_frame;
 
@@ -1177,10 +1167,7 @@ void svt_av1_loop_restoration_filter_frame(int32_t* rst_tmpbuf, Yv12BufferConfig
         SVT_LOG("Failed to allocate restoration dst buffer\n");
     }
 
-    RestorationLineBuffers rlbs;
-    const int32_t          bit_depth = cm->bit_depth;
-    const int32_t          highbd    = cm->use_highbitdepth;
-
+    uint32_t unit_rows = 0;
     for (int32_t plane = 0; plane < num_planes; ++plane) {
         RestorationInfo* rsi   = &cm->child_pcs->rst_info[plane];
         RestorationType  rtype = rsi->frame_restoration_type;
@@ -1199,24 +1186,109 @@ void svt_av1_loop_restoration_filter_frame(int32_t* rst_tmpbuf, Yv12BufferConfig
                          frame->strides[is_uv],
                          RESTORATION_BORDER,
                          RESTORATION_BORDER,
-                         highbd);
-
-        FilterFrameCtxt ctxt;
-        ctxt.rsi         = rsi;
-        ctxt.rlbs        = &rlbs;
-        ctxt.cm          = cm;
-        ctxt.ss_x        = is_uv && cm->subsampling_x;
-        ctxt.ss_y        = is_uv && cm->subsampling_y;
-        ctxt.highbd      = highbd;
-        ctxt.bit_depth   = bit_depth;
-        ctxt.data8       = frame->buffers[plane];
-        ctxt.dst8        = dst->buffers[plane];
-        ctxt.data_stride = frame->strides[is_uv];
-        ctxt.dst_stride  = dst->strides[is_uv];
-        ctxt.tmpbuf      = rst_tmpbuf;
-        svt_aom_foreach_rest_unit_in_frame(cm, plane, filter_frame_on_tile, filter_frame_on_unit, &ctxt);
-
-        copy_funs[plane](dst, frame);
+                         cm->use_highbitdepth);
+        unit_rows += rsi->vert_units_per_tile;
+    }
+    return unit_rows;
+}
+
+void svt_av1_loop_restoration_filter_unit_row(int32_t* rst_tmpbuf, Yv12BufferConfig* frame, Yv12BufferConfig* scratch,
+                                              Av1Common* cm, uint32_t unit_row) {
+    // Map the row index onto a plane, in the order svt_av1_loop_restoration_filter_frame_init() counted them
+    int32_t plane = 0;
+    for (; plane < 3; ++plane) {
+        const RestorationInfo* rsi = &cm->child_pcs->rst_info[plane];
+        if (rsi->frame_restoration_type == RESTORE_NONE) {
+            continue;
+        }
+        if (unit_row < (uint32_t)rsi->vert_units_per_tile) {
+            break;
+        }
+        unit_row -= rsi->vert_units_per_tile;
+    }
+    assert(plane < 3);
+
+    const RestorationInfo* rsi       = &cm->child_pcs->rst_info[plane];
+    const int32_t          is_uv     = plane > 0;
+    const int32_t          ss_x      = is_uv && cm->subsampling_x;
+    const int32_t          ss_y      = is_uv && cm->subsampling_y;
+    const int32_t          highbd    = cm->use_highbitdepth;
+    const int32_t          unit_size = rsi->restoration_unit_size;
+    const int32_t          ext_size  = unit_size * 3 / 2;
+    const Av1PixelRect tile_rect = whole_frame_rect(&cm->frm_size, cm->subsampling_x, cm->subsampling_y, is_uv);
+    const int32_t      tile_w    = tile_rect.right - tile_rect.left;
+    const int32_t      tile_h    = tile_rect.bottom - tile_rect.top;
+
+    // Same row split as foreach_rest_unit_in_tile(): every row but the last is unit_size high
+    const int32_t         y0 = unit_row * unit_size;
+    const int32_t         h  = (tile_h - y0 < ext_size) ? tile_h - y0 : unit_size;
+    RestorationTileLimits limits;
+    limits.v_start        = tile_rect.top + y0;
+    limits.v_end          = tile_rect.top + y0 + h;
+    const int32_t voffset = RESTORATION_UNIT_OFFSET >> ss_y;
+    limits.v_start        = AOMMAX(tile_rect.top, limits.v_start - voffset);
+    if (limits.v_end < tile_rect.bottom) {
+        limits.v_end -= voffset;
+    }
+
+    uint8_t* data8       = frame->buffers[plane];
+    int32_t  data_stride = frame->strides[is_uv];
+    if (scratch) {
+        // The stripe boundaries are patched into the source rows just outside each stripe while it is filtered,
+        // which would race with the rows above and below filtered concurrently. Filter from a private copy of the
+        // rows this unit row reads instead.
+        const int32_t margin_x = RESTORATION_EXTRA_HORZ;
+        const int32_t rows     = limits.v_end - limits.v_start + 2 * RESTORATION_BORDER;
+        const int32_t row_size = (tile_w + 2 * margin_x) << highbd;
+        const int32_t y_start  = limits.v_start - RESTORATION_BORDER;
+        uint8_t*      src      = frame->buffers[plane] + y_start * data_stride - margin_x;
+        uint8_t*      dst      = scratch->buffers[plane] + y_start * scratch->strides[is_uv] - margin_x;
+        for (int32_t r = 0; r < rows; ++r) {
+            svt_memcpy(REAL_PTR(highbd, dst + r * scratch->strides[is_uv]),
+                       REAL_PTR(highbd, src + r * data_stride),
+                       row_size);
+        }
+        data8       = scratch->buffers[plane];
+        data_stride = scratch->strides[is_uv];
+    }
+
+    RestorationLineBuffers rlbs;
+    FilterFrameCtxt        ctxt;
+    ctxt.rsi          = rsi;
+    ctxt.rlbs         = &rlbs;
+    ctxt.cm           = cm;
+    ctxt.tile_stripe0 = 0;
+    ctxt.ss_x         = ss_x;
+    ctxt.ss_y         = ss_y;
+    ctxt.highbd       = highbd;
+    ctxt.bit_depth    = cm->bit_depth;
+    ctxt.data8        = data8;
+    ctxt.dst8         = cm->rst_frame.buffers[plane];
+    ctxt.data_stride  = data_stride;
+    ctxt.dst_stride   = cm->rst_frame.strides[is_uv];
+    ctxt.tmpbuf       = rst_tmpbuf;
+
+    int32_t x0 = 0, j = 0;
+    while (x0 < tile_w) {
+        const int32_t w = (tile_w - x0 < ext_size) ? tile_w - x0 : unit_size;
+        limits.h_start  = tile_rect.left + x0;
+        limits.h_end    = tile_rect.left + x0 + w;
+        filter_frame_on_unit(&limits, &tile_rect, unit_row * rsi->horz_units_per_tile + j, &ctxt);
+        x0 += w;
+        ++j;
+    }
+}
+
+void svt_av1_loop_restoration_filter_frame_finish(Yv12BufferConfig* frame, Av1Common* cm) {
+    typedef void (*CopyFun)(const Yv12BufferConfig* src, Yv12BufferConfig* dst);
+    static const CopyFun copy_funs[3] = {
+        svt_aom_yv12_copy_y_c, svt_aom_yv12_copy_u_c, svt_aom_yv12_copy_v_c}; //CHKN SSE
+
+    Yv12BufferConfig* dst = &cm->rst_frame;
+    for (int32_t plane = 0; plane < 3; ++plane) {
+        if (cm->child_pcs->rst_info[plane].frame_restoration_type != RESTORE_NONE) {
+            copy_funs[plane](dst, frame);
+        }
     }
     if (dst->buffer_alloc_sz) {
         dst->buffer_alloc_sz = 0;
@@ -1224,6 +1296,16 @@ void svt_av1_loop_restoration_filter_frame(int32_t* rst_tmpbuf, Yv12BufferConfig
     }
 }
 
+void svt_av1_loop_restoration_filter_frame(int32_t* rst_tmpbuf, Yv12BufferConfig* frame, Av1Common* cm,
+                                           int32_t optimized_lr) {
+    const uint32_t unit_rows = svt_av1_loop_restoration_filter_frame_init(frame, cm, optimized_lr);
+    // Rows run one after the other, so they can filter the frame in place
+    for (uint32_t unit_row = 0; unit_row < unit_rows; ++unit_row) {
+        svt_av1_loop_restoration_filter_unit_row(rst_tmpbuf, frame, NULL, cm, unit_row);
+    }
+    svt_av1_loop_restoration_filter_frame_finish(frame, cm);
+}
+
 static void foreach_rest_unit_in_tile(const Av1PixelRect* tile_rect, int32_t tile_row, int32_t tile_col,
                                       int32_t tile_cols, int32_t hunits_per_tile, int32_t units_per_tile,
                                       int32_t unit_size, int32_t ss_y, RestUnitVisitor on_rest_unit, void* priv) {
@@ -331,6 +331,19 @@ int32_t svt_av1_loop_restoration_corners_in_sb(struct Av1Common* cm, SeqHeader*
 
 void svt_av1_loop_restoration_save_boundary_lines(const Yv12BufferConfig* frame, struct Av1Common* cm,
                                                   int32_t after_cdef);
+// Frame-level loop restoration, split so that the work can be shared between threads:
+// - svt_av1_loop_restoration_filter_frame_init() prepares the frame and returns the number of
+//   (plane, restoration unit row) jobs.
+// - svt_av1_loop_restoration_filter_unit_row() filters one job into cm->rst_frame. When several
+//   jobs run concurrently, each needs a frame-sized scratch buffer to filter from; with scratch
+//   set to NULL the frame is read in place, which is only safe when jobs run one at a time.
+// - svt_av1_loop_restoration_filter_frame_finish() copies the filtered planes back once all
+//   jobs are done.
+uint32_t svt_av1_loop_restoration_filter_frame_init(Yv12BufferConfig* frame, struct Av1Common* cm,
+                                                    int32_t optimized_lr);
+void     svt_av1_loop_restoration_filter_unit_row(int32_t* rst_tmpbuf, Yv12BufferConfig* frame,
+                                                  Yv12BufferConfig* scratch, struct Av1Common* cm, uint32_t unit_row);
+void     svt_av1_loop_restoration_filter_frame_finish(Yv12BufferConfig* frame, struct Av1Common* cm);
 void svt_aom_foreach_rest_unit_in_frame(struct Av1Common* cm, int32_t plane, RestTileStartVisitor on_tile,
                                         RestUnitVisitor on_rest_unit, void* priv);
 void svt_aom_foreach_rest_unit_in_frame_seg(struct Av1Common* cm, int32_t plane, RestTileStartVisitor on_tile,
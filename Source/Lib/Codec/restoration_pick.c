@@ -551,6 +551,15 @@ static INLINE void apply_sgr(int32_t sgr_params_idx, const uint8_t* dat8, int32_
     }
 }
 
+// Whether parameter set ep, which only uses the r[1] filter, produces the same
+// flt1 output as parameter set ref_ep.
+static INLINE int32_t sgr_params_share_flt1(int32_t ep, int32_t ref_ep) {
+    const SgrParamsType* const params     = &svt_aom_eb_sgr_params[ep];
+    const SgrParamsType* const ref_params = &svt_aom_eb_sgr_params[ref_ep];
+    return params->r[0] == 0 && params->r[1] > 0 && params->r[1] == ref_params->r[1] &&
+        params->s[1] == ref_params->s[1];
+}
+
 static SgrprojInfo search_selfguided_restoration(const uint8_t* dat8, int32_t width, int32_t height, int32_t dat_stride,
                                                  const uint8_t* src8, int32_t src_stride, int32_t use_highbitdepth,
                                                  int32_t bit_depth, int32_t pu_width, int32_t pu_height,
@@ -568,20 +577,52 @@ static SgrprojInfo search_selfguided_restoration(const uint8_t* dat8, int32_t wi
     int8_t end_ep    = ctrls->end_ep[plane];
     int8_t ep_inc    = ctrls->ep_inc[plane];
     int8_t do_refine = ctrls->refine[plane];
+
+    // Parameter sets that only use the r[1] filter may share r[1] and s[1] with a
+    // two-pass set (e.g. 11 and 2), in which case their flt1 output is identical.
+    // Evaluate such sets right after their two-pass partner so the filter output
+    // still in flt1 is reused instead of being recomputed.
+    int8_t  ep_list[SGRPROJ_PARAMS];
+    uint8_t ep_queued[SGRPROJ_PARAMS] = {0};
+    int32_t ep_count                  = 0;
     for (ep = start_ep; ep < end_ep; ep += ep_inc) {
+        if (ep_queued[ep]) {
+            continue;
+        }
+        ep_list[ep_count++] = ep;
+        ep_queued[ep]       = 1;
+        if (svt_aom_eb_sgr_params[ep].r[0] == 0 || svt_aom_eb_sgr_params[ep].r[1] == 0) {
+            continue;
+        }
+        for (int32_t ep2 = ep + ep_inc; ep2 < end_ep; ep2 += ep_inc) {
+            if (!ep_queued[ep2] && sgr_params_share_flt1(ep2, ep)) {
+                ep_list[ep_count++] = ep2;
+                ep_queued[ep2]      = 1;
+            }
+        }
+    }
+
+    int32_t flt1_ep = -1; // parameter set whose r[1] output is held in flt1
+    for (int32_t idx = 0; idx < ep_count; idx++) {
         int32_t exq[2];
-        apply_sgr(ep,
-                  dat8,
-                  width,
-                  height,
-                  dat_stride,
-                  use_highbitdepth,
-                  bit_depth,
-                  pu_width,
-                  pu_height,
-                  flt0,
-                  flt1,
-                  flt_stride);
+        ep = ep_list[idx];
+        if (svt_aom_eb_sgr_params[ep].r[0] > 0 || flt1_ep < 0 || !sgr_params_share_flt1(ep, flt1_ep)) {
+            apply_sgr(ep,
+                      dat8,
+                      width,
+                      height,
+                      dat_stride,
+                      use_highbitdepth,
+                      bit_depth,
+                      pu_width,
+                      pu_height,
+                      flt0,
+                      flt1,
+                      flt_stride);
+            if (svt_aom_eb_sgr_params[ep].r[1] > 0) {
+                flt1_ep = ep;
+            }
+        }
 
         const SgrParamsType* const params = &svt_aom_eb_sgr_params[ep];
         svt_get_proj_subspace(src8,
@@ -614,7 +655,8 @@ static SgrprojInfo search_selfguided_restoration(const uint8_t* dat8, int32_t wi
                                                     exqd,
                                                     do_refine,
                                                     params);
-        if (besterr == -1 || err < besterr) {
+        // Sets may be evaluated out of order; on ties keep the lowest index.
+        if (besterr == -1 || err < besterr || (err == besterr && ep < bestep)) {
             bestep     = ep;
             besterr    = err;
             bestxqd[0] = exqd[0];
@@ -1807,7 +1807,11 @@ static EbErrorType tpl_mc_flow(EncodeContext* enc_ctx, SequenceControlSet* scs,
             // NREF need recon buffer for intra pred
             EbObjectWrapper* ref_pic_wrapper;
             // Get Empty Reference Picture Object
-            svt_get_empty_object(scs->enc_ctx->tpl_reference_picture_pool_fifo_ptr, &ref_pic_wrapper);
+            EbErrorType return_error = svt_get_empty_object(scs->enc_ctx->tpl_reference_picture_pool_fifo_ptr,
+                                                            &ref_pic_wrapper);
+            if (return_error != EB_ErrorNone) {
+                return return_error;
+            }
             // if resolution has changed, and the tpl_reference_picture settings do not match scs settings, update tpl reference params
             if (((EbTplReferenceObject*)ref_pic_wrapper->object_ptr)->ref_picture_ptr->max_width !=
                     scs->max_input_luma_width ||
@@ -2362,7 +2366,14 @@ void* svt_aom_source_based_operations_kernel(void* input_ptr) {
             // tpl ME can be performed on unscaled frames in super-res q-threshold and auto mode
             if (!pcs->frame_superres_enabled && pcs->temporal_layer_index == 0) {
                 tpl_prep_info(pcs);
-                tpl_mc_flow(scs->enc_ctx, scs, pcs, context_ptr);
+                const EbErrorType err = tpl_mc_flow(scs->enc_ctx, scs, pcs, context_ptr);
+                if (err != EB_ErrorNone) {
+                    if (err != EB_NoErrorFifoShutdown) {
+                        scs->enc_ctx->app_callback_ptr->error_handler(scs->enc_ctx->app_callback_ptr->handle,
+                                                                      (uint32_t)err);
+                    }
+                    return NULL;
+                }
             }
             bool release_pa_ref = (scs->static_config.superres_mode <= SUPERRES_RANDOM) ? true : false;
             // Release Pa Ref if lad_mg is 0 and P slice and not flat struct (not belonging to any TPL group)
@@ -14,6 +14,7 @@
 #include "utility.h"
 #include "super_res.h"
 #include "intra_prediction.h"
+#include "aom_dsp_rtcd.h"
 
 #define FILTER_BITS 7
 
@@ -80,8 +81,8 @@ static int32_t get_upscale_convolve_x0(int in_length, int out_length, int32_t x_
     return (int32_t)((uint32_t)x0 & RS_SCALE_SUBPEL_MASK);
 }
 
-static void av1_convolve_horiz_rs_c(const uint8_t* src, int src_stride, uint8_t* dst, int dst_stride, int w, int h,
-                                    const int16_t* x_filters, int x0_qn, int x_step_qn) {
+void svt_av1_convolve_horiz_rs_c(const uint8_t* src, int src_stride, uint8_t* dst, int dst_stride, int w, int h,
+                                 const int16_t* x_filters, int x0_qn, int x_step_qn) {
     src -= UPSCALE_NORMATIVE_TAPS / 2 - 1;
     for (int y = 0; y < h; ++y) {
         int x_qn = x0_qn;
@@ -102,8 +103,8 @@ static void av1_convolve_horiz_rs_c(const uint8_t* src, int src_stride, uint8_t*
     }
 }
 
-static void av1_highbd_convolve_horiz_rs_c(const uint16_t* src, int src_stride, uint16_t* dst, int dst_stride, int w,
-                                           int h, const int16_t* x_filters, int x0_qn, int x_step_qn, int bd) {
+void svt_av1_highbd_convolve_horiz_rs_c(const uint16_t* src, int src_stride, uint16_t* dst, int dst_stride, int w,
+                                        int h, const int16_t* x_filters, int x0_qn, int x_step_qn, int bd) {
     src -= UPSCALE_NORMATIVE_TAPS / 2 - 1;
     for (int y = 0; y < h; ++y) {
         int x_qn = x0_qn;
@@ -160,15 +161,15 @@ void upscale_normative_rect(const uint8_t* const input, int height, int width, i
         }
     }
 
-    av1_convolve_horiz_rs_c(input - 1,
-                            in_stride,
-                            output,
-                            out_stride,
-                            width2,
-                            height2,
-                            &svt_av1_resize_filter_normative[0][0],
-                            x0_qn,
-                            x_step_qn);
+    svt_av1_convolve_horiz_rs(input - 1,
+                              in_stride,
+                              output,
+                              out_stride,
+                              width2,
+                              height2,
+                              &svt_av1_resize_filter_normative[0][0],
+                              x0_qn,
+                              x_step_qn);
 
     /* Restore the left/right border pixels */
     if (pad_left) {
@@ -222,16 +223,16 @@ static void highbd_upscale_normative_rect(const uint8_t* const input, int height
         }
     }
 
-    av1_highbd_convolve_horiz_rs_c(((uint16_t*)(input)-1),
-                                   in_stride,
-                                   (uint16_t*)(output),
-                                   out_stride,
-                                   width2,
-                                   height2,
-                                   &svt_av1_resize_filter_normative[0][0],
-                                   x0_qn,
-                                   x_step_qn,
-                                   bd);
+    svt_av1_highbd_convolve_horiz_rs(((uint16_t*)(input)-1),
+                                     in_stride,
+                                     (uint16_t*)(output),
+                                     out_stride,
+                                     width2,
+                                     height2,
+                                     &svt_av1_resize_filter_normative[0][0],
+                                     x0_qn,
+                                     x_step_qn,
+                                     bd);
 
     /*Restore the left/right border pixels*/
     if (pad_left) {
@@ -11,13 +11,12 @@
 */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "sys_resource_manager.h"
 #include "definitions.h"
 #include "svt_threads.h"
-#if SRM_REPORT
 #include "svt_log.h"
-#endif
 static void svt_fifo_dctor(EbPtr p) {
     EbFifo* obj = (EbFifo*)p;
     EB_DESTROY_SEMAPHORE(obj->counting_semaphore);
@@ -396,10 +395,15 @@ static EbErrorType svt_object_wrapper_ctor(EbObjectWrapper* wrapper, EbSystemRes
     EbErrorType ret;
 
     wrapper->dctor               = svt_object_wrapper_dctor;
+    wrapper->live_count          = EB_ObjectWrapperReleasedValue;
     wrapper->release_enable      = true;
     wrapper->system_resource_ptr = resource;
     wrapper->object_destroyer    = object_destroyer;
-    ret                          = object_creator(&wrapper->object_ptr, object_init_data_ptr);
+    // Objects of lazily constructed resources are created in svt_get_empty_object
+    if (!object_creator) {
+        return EB_ErrorNone;
+    }
+    ret = object_creator(&wrapper->object_ptr, object_init_data_ptr);
     if (ret != EB_ErrorNone) {
         return ret;
     }
@@ -411,51 +415,31 @@ static void svt_system_resource_dctor(EbPtr p) {
     EB_DELETE(obj->full_queue);
     EB_DELETE(obj->empty_queue);
     EB_DELETE_PTR_ARRAY(obj->wrapper_ptr_pool, obj->object_total_count);
+    if (obj->object_init_data_ptr) {
+        EB_FREE(obj->object_init_data_ptr);
+    }
 }
 
-/*********************************************************************
- * svt_system_resource_ctor
- *   Constructor for EbSystemResource.  Fully constructs all members
- *   of EbSystemResource including the object with the passed
- *   object_ctor function.
- *
- *   resource_ptr
- *     pointer that will contain the SystemResource to be constructed.
- *
- *   object_total_count
- *     Number of objects to be managed by the SystemResource.
- *
- *   object_ctor
- *     Function pointer to the constructor of the object managed by
- *     SystemResource referenced by resource_ptr. No object level
- *     construction is performed if object_ctor is NULL.
- *
- *   object_init_data_ptr
-
- *     pointer to data block to be used during the construction of
- *     the object. object_init_data_ptr is passed to object_ctor when
- *     object_ctor is called.
- *   object_destroyer
- *     object destroyer, will call dctor if this is null
- *********************************************************************/
-EbErrorType svt_system_resource_ctor(EbSystemResource* resource_ptr, uint32_t object_total_count,
-                                     uint32_t producer_process_total_count, uint32_t consumer_process_total_count,
-                                     EbCreator object_creator, EbPtr object_init_data_ptr, EbDctor object_destroyer) {
+static EbErrorType system_resource_ctor(EbSystemResource* resource_ptr, uint32_t object_total_count,
+                                        uint32_t eager_object_count, uint32_t producer_process_total_count,
+                                        uint32_t consumer_process_total_count, EbCreator object_creator,
+                                        EbPtr object_init_data_ptr, EbDctor object_destroyer) {
     uint32_t    wrapper_index;
     EbErrorType return_error = EB_ErrorNone;
     resource_ptr->dctor      = svt_system_resource_dctor;
 
-    resource_ptr->object_total_count = object_total_count;
+    resource_ptr->object_total_count   = object_total_count;
+    resource_ptr->object_created_count = eager_object_count;
 
     // Allocate array for wrapper pointers
     EB_ALLOC_PTR_ARRAY(resource_ptr->wrapper_ptr_pool, resource_ptr->object_total_count);
 
-    // Initialize each wrapper
+    // Initialize each wrapper, only the first eager_object_count ones get their object now
     for (wrapper_index = 0; wrapper_index < resource_ptr->object_total_count; ++wrapper_index) {
         EB_NEW(resource_ptr->wrapper_ptr_pool[wrapper_index],
                svt_object_wrapper_ctor,
                resource_ptr,
-               object_creator,
+               wrapper_index < eager_object_count ? object_creator : NULL,
                object_init_data_ptr,
                object_destroyer);
 
@@ -491,6 +475,69 @@ EbErrorType svt_system_resource_ctor(EbSystemResource* resource_ptr, uint32_t ob
     return return_error;
 }
 
+/*********************************************************************
+ * svt_system_resource_ctor
+ *   Constructor for EbSystemResource.  Fully constructs all members
+ *   of EbSystemResource including the object with the passed
+ *   object_ctor function.
+ *
+ *   resource_ptr
+ *     pointer that will contain the SystemResource to be constructed.
+ *
+ *   object_total_count
+ *     Number of objects to be managed by the SystemResource.
+ *
+ *   object_ctor
+ *     Function pointer to the constructor of the object managed by
+ *     SystemResource referenced by resource_ptr. No object level
+ *     construction is performed if object_ctor is NULL.
+ *
+ *   object_init_data_ptr
+
+ *     pointer to data block to be used during the construction of
+ *     the object. object_init_data_ptr is passed to object_ctor when
+ *     object_ctor is called.
+ *   object_destroyer
+ *     object destroyer, will call dctor if this is null
+ *********************************************************************/
+EbErrorType svt_system_resource_ctor(EbSystemResource* resource_ptr, uint32_t object_total_count,
+                                     uint32_t producer_process_total_count, uint32_t consumer_process_total_count,
+                                     EbCreator object_creator, EbPtr object_init_data_ptr, EbDctor object_destroyer) {
+    return system_resource_ctor(resource_ptr,
+                                object_total_count,
+                                object_total_count,
+                                producer_process_total_count,
+                                consumer_process_total_count,
+                                object_creator,
+                                object_init_data_ptr,
+                                object_destroyer);
+}
+
+/*********************************************************************
+ * svt_system_resource_lazy_ctor
+ *   Constructs the first object only; the others are constructed by
+ *   svt_get_empty_object on first use from a copy of the init data.
+ *********************************************************************/
+EbErrorType svt_system_resource_lazy_ctor(EbSystemResource* resource_ptr, uint32_t object_total_count,
+                                          uint32_t producer_process_total_count,
+                                          uint32_t consumer_process_total_count, EbCreator object_creator,
+                                          EbPtr object_init_data_ptr, size_t object_init_data_size,
+                                          EbDctor object_destroyer) {
+    resource_ptr->object_creator = object_creator;
+    if (object_init_data_ptr && object_init_data_size) {
+        EB_MALLOC(resource_ptr->object_init_data_ptr, object_init_data_size);
+        memcpy(resource_ptr->object_init_data_ptr, object_init_data_ptr, object_init_data_size);
+    }
+    return system_resource_ctor(resource_ptr,
+                                object_total_count,
+                                object_total_count ? 1 : 0,
+                                producer_process_total_count,
+                                consumer_process_total_count,
+                                object_creator,
+                                resource_ptr->object_init_data_ptr,
+                                object_destroyer);
+}
+
 EbFifo* svt_system_resource_get_producer_fifo(const EbSystemResource* resource_ptr, uint32_t index) {
     return svt_muxing_queue_get_fifo(resource_ptr->empty_queue, index);
 }
@@ -513,6 +560,75 @@ EbErrorType svt_shutdown_process(const EbSystemResource* resource_ptr) {
     return EB_ErrorNone;
 }
 
+EbErrorType svt_shutdown_producers(const EbSystemResource* resource_ptr) {
+    //not fully constructed
+    if (!resource_ptr || !resource_ptr->empty_queue) {
+        return EB_ErrorNone;
+    }
+
+    //notify all producers waiting for an empty object we are shutting down
+    for (unsigned int i = 0; i < resource_ptr->empty_queue->process_total_count; i++) {
+        EbFifo* fifo_ptr = svt_system_resource_get_producer_fifo(resource_ptr, i);
+        svt_fifo_shutdown(fifo_ptr);
+    }
+    return EB_ErrorNone;
+}
+
+/**************************************
+ * svt_muxing_queue_reset
+ **************************************/
+static EbErrorType svt_muxing_queue_reset(EbMuxingQueue* queue_ptr, uint32_t object_total_count) {
+    EbCircularBuffer* buffers[] = {queue_ptr->object_queue, queue_ptr->process_queue};
+    for (unsigned int i = 0; i < sizeof(buffers) / sizeof(buffers[0]); i++) {
+        memset(buffers[i]->array_ptr, 0, buffers[i]->buffer_total_count * sizeof(EbPtr));
+        buffers[i]->head_index    = 0;
+        buffers[i]->tail_index    = 0;
+        buffers[i]->current_count = 0;
+    }
+    for (uint32_t process_index = 0; process_index < queue_ptr->process_total_count; ++process_index) {
+        EbFifo* fifo_ptr = queue_ptr->process_fifo_ptr_array[process_index];
+        // A new semaphore drops the posts of objects left in the fifo and of the shutdown signal
+        EB_DESTROY_SEMAPHORE(fifo_ptr->counting_semaphore);
+        EB_CREATE_SEMAPHORE(fifo_ptr->counting_semaphore, 0, object_total_count);
+        fifo_ptr->first_ptr   = NULL;
+        fifo_ptr->last_ptr    = NULL;
+        fifo_ptr->quit_signal = false;
+    }
+    return EB_ErrorNone;
+}
+
+EbErrorType svt_system_resource_reset(EbSystemResource* resource_ptr) {
+    EbErrorType return_error = svt_muxing_queue_reset(resource_ptr->empty_queue, resource_ptr->object_total_count);
+    if (return_error == EB_ErrorNone && resource_ptr->full_queue) {
+        return_error = svt_muxing_queue_reset(resource_ptr->full_queue, resource_ptr->object_total_count);
+    }
+    if (return_error != EB_ErrorNone) {
+        return return_error;
+    }
+    // Same order as at construction time, constructed objects are kept
+    for (uint32_t wrapper_index = 0; wrapper_index < resource_ptr->object_total_count; ++wrapper_index) {
+        EbObjectWrapper* wrapper_ptr = resource_ptr->wrapper_ptr_pool[wrapper_index];
+        wrapper_ptr->live_count      = EB_ObjectWrapperReleasedValue;
+        wrapper_ptr->release_enable  = true;
+        wrapper_ptr->next_ptr        = NULL;
+        svt_circular_buffer_push_back(resource_ptr->empty_queue->object_queue, wrapper_ptr);
+    }
+#if SRM_REPORT
+    resource_ptr->empty_queue->curr_count = resource_ptr->object_total_count;
+#endif
+    return EB_ErrorNone;
+}
+
+uint32_t svt_system_resource_taken_count(const EbSystemResource* resource_ptr) {
+    uint32_t taken_count = 0;
+    for (uint32_t wrapper_index = 0; wrapper_index < resource_ptr->object_total_count; ++wrapper_index) {
+        if (resource_ptr->wrapper_ptr_pool[wrapper_index]->live_count != EB_ObjectWrapperReleasedValue) {
+            ++taken_count;
+        }
+    }
+    return taken_count;
+}
+
 /*********************************************************************
  * EbSystemResourceReleaseProcess
  *********************************************************************/
@@ -649,6 +765,29 @@ EbErrorType dump_srm_content(EbSystemResource* resource_ptr, uint8_t log) {
     return return_error;
 }
 #endif
+/*********************************************************************
+ * svt_object_wrapper_create_object
+ *   Constructs the object of a wrapper belonging to a resource built
+ *   with svt_system_resource_lazy_ctor. Only the thread that dequeued
+ *   the wrapper can reach it, so no lock is needed for the object itself.
+ *********************************************************************/
+static EbErrorType svt_object_wrapper_create_object(EbObjectWrapper* wrapper_ptr) {
+    EbSystemResource* resource_ptr = wrapper_ptr->system_resource_ptr;
+    if (!resource_ptr->object_creator) {
+        return EB_ErrorNone;
+    }
+    EbErrorType return_error = resource_ptr->object_creator(&wrapper_ptr->object_ptr,
+                                                            resource_ptr->object_init_data_ptr);
+    if (return_error != EB_ErrorNone || !wrapper_ptr->object_ptr) {
+        SVT_ERROR("failed to allocate a pipeline object on demand\n");
+        return EB_ErrorInsufficientResources;
+    }
+    svt_block_on_mutex(resource_ptr->empty_queue->lockout_mutex);
+    resource_ptr->object_created_count++;
+    svt_release_mutex(resource_ptr->empty_queue->lockout_mutex);
+    return EB_ErrorNone;
+}
+
 /*********************************************************************
  * EbSystemResourceGetEmptyObject
  *   Dequeues an empty EbObjectWrapper from the SystemResource.  This
@@ -676,6 +815,13 @@ EbErrorType svt_get_empty_object(EbFifo* empty_fifo_ptr, EbObjectWrapper** wrapp
     // Acquire lockout Mutex
     svt_block_on_mutex(empty_fifo_ptr->lockout_mutex);
 
+    // The fifo is shut down when the pipeline stopped on an error and will not release objects anymore
+    if (empty_fifo_ptr->quit_signal) {
+        *wrapper_dbl_ptr = NULL;
+        svt_release_mutex(empty_fifo_ptr->lockout_mutex);
+        return EB_NoErrorFifoShutdown;
+    }
+
     // Get the empty object
     svt_fifo_pop_front(empty_fifo_ptr, wrapper_dbl_ptr);
 
@@ -702,6 +848,16 @@ EbErrorType svt_get_empty_object(EbFifo* empty_fifo_ptr, EbObjectWrapper** wrapp
     // Release Mutex
     svt_release_mutex(empty_fifo_ptr->lockout_mutex);
 
+    // First use of a wrapper from a lazily constructed resource
+    if (!(*wrapper_dbl_ptr)->object_ptr) {
+        return_error = svt_object_wrapper_create_object(*wrapper_dbl_ptr);
+        if (return_error != EB_ErrorNone) {
+            // Hand the wrapper back so the pool keeps its count; its object is retried on the next get
+            svt_release_object(*wrapper_dbl_ptr);
+            *wrapper_dbl_ptr = NULL;
+        }
+    }
+
     return return_error;
 }
 
@@ -38,6 +38,7 @@ typedef struct EbObjectWrapper {
     // live_count - a count of the number of pictures actively being
     //   encoded in the pipeline at any given time.  Modification
     //   of this value by any process must be protected by a mutex.
+    //   EB_ObjectWrapperReleasedValue while the wrapper is in the pool.
     uint32_t live_count;
 
     // release_enable - a flag that enables the release of
@@ -142,6 +143,14 @@ typedef struct EbSystemResource {
 
     // The full FIFO contains a queue of completed buffers
     EbMuxingQueue* full_queue;
+    // object_creator & object_init_data_ptr - kept by resources whose objects
+    //   are constructed on first use (see svt_system_resource_lazy_ctor).
+    //   object_init_data_ptr is a copy owned by the resource.
+    EbCreator object_creator;
+    EbPtr     object_init_data_ptr;
+    // object_created_count - A count of the objects constructed so far,
+    //   i.e. the peak number of objects the pipeline has needed.
+    uint32_t object_created_count;
 } EbSystemResource;
 
 /*********************************************************************
@@ -220,6 +229,24 @@ EbErrorType svt_object_inc_live_count(EbObjectWrapper* wrapper_ptr, uint32_t inc
 EbErrorType svt_system_resource_ctor(EbSystemResource* resource_ptr, uint32_t object_total_count,
                                      uint32_t producer_process_total_count, uint32_t consumer_process_total_count,
                                      EbCreator object_ctor, EbPtr object_init_data_ptr, EbDctor object_destroyer);
+/*********************************************************************
+     * svt_system_resource_lazy_ctor
+     *   Same as svt_system_resource_ctor, except that only the first
+     *   object is constructed up front. The others are constructed by
+     *   svt_get_empty_object the first time their wrapper is handed out,
+     *   so the memory held by the resource follows the number of objects
+     *   the pipeline actually keeps in flight instead of the worst case.
+     *
+     *   object_init_data_ptr / object_init_data_size
+     *     the init data is copied, so it does not have to outlive the
+     *     call. Any pointers it contains must stay valid until the
+     *     resource is destroyed.
+     *********************************************************************/
+EbErrorType svt_system_resource_lazy_ctor(EbSystemResource* resource_ptr, uint32_t object_total_count,
+                                          uint32_t producer_process_total_count,
+                                          uint32_t consumer_process_total_count, EbCreator object_ctor,
+                                          EbPtr object_init_data_ptr, size_t object_init_data_size,
+                                          EbDctor object_destroyer);
 
 /*********************************************************************
      * svt_system_resource_get_producer_fifo
@@ -260,6 +287,10 @@ EbFifo* svt_system_resource_get_consumer_fifo(const EbSystemResource* resource_p
      *   wrapper_dbl_ptr
      *      Double pointer used to pass the pointer to the empty
      *      EbObjectWrapper pointer.
+     *
+     *   For resources built with svt_system_resource_lazy_ctor, returns
+     *   EB_ErrorInsufficientResources if the object could not be
+     *   constructed.
      *********************************************************************/
 EbErrorType svt_get_empty_object(EbFifo* empty_fifo_ptr, EbObjectWrapper** wrapper_dbl_ptr);
 #if SRM_REPORT
@@ -325,6 +356,40 @@ EbErrorType svt_release_object(EbObjectWrapper* object_ptr);
      *********************************************************************/
 EbErrorType svt_shutdown_process(const EbSystemResource* resource_ptr);
 
+/*********************************************************************
+     * svt_shutdown_producers
+     *   Notify shut down signal to the producers of EbSystemResource.
+     *   svt_get_empty_object then returns EB_NoErrorFifoShutdown to them
+     *   instead of waiting for objects that will not be released.
+     *
+     *   resource_ptr
+     *      pointer to the SystemResource.
+     *********************************************************************/
+EbErrorType svt_shutdown_producers(const EbSystemResource* resource_ptr);
+
+/*********************************************************************
+     * svt_system_resource_reset
+     *   Returns every EbObjectWrapper of the SystemResource to the empty
+     *   queue and clears the fifos and the shutdown signal, as after
+     *   construction. Objects constructed so far are kept. The processes
+     *   using the SystemResource must have exited.
+     *
+     *   resource_ptr
+     *      pointer to the SystemResource.
+     *********************************************************************/
+EbErrorType svt_system_resource_reset(EbSystemResource* resource_ptr);
+
+/*********************************************************************
+     * svt_system_resource_taken_count
+     *   Returns the number of EbObjectWrappers taken from the empty queue
+     *   and not released yet. The count is only stable when nothing takes
+     *   or releases objects of the SystemResource meanwhile.
+     *
+     *   resource_ptr
+     *      pointer to the SystemResource.
+     *********************************************************************/
+uint32_t svt_system_resource_taken_count(const EbSystemResource* resource_ptr);
+
 #define EB_GET_FULL_OBJECT(full_fifo_ptr, wrapper_dbl_ptr)                     \
     do {                                                                       \
         EbErrorType err = svt_get_full_object(full_fifo_ptr, wrapper_dbl_ptr); \
@@ -332,6 +397,19 @@ EbErrorType svt_shutdown_process(const EbSystemResource* resource_ptr);
             return NULL;                                                       \
     } while (0)
 
+// For the pools built with svt_system_resource_lazy_ctor, whose objects can fail to be constructed on first use.
+// The failure is posted to the application as an error packet and the calling kernel exits. The kernel
+// also exits, without a second report, when the pool was shut down after an error elsewhere.
+#define EB_GET_EMPTY_OBJECT(empty_fifo_ptr, wrapper_dbl_ptr, app_callback_ptr)                \
+    do {                                                                                      \
+        EbErrorType err = svt_get_empty_object(empty_fifo_ptr, wrapper_dbl_ptr);              \
+        if (err != EB_ErrorNone) {                                                            \
+            if (err != EB_NoErrorFifoShutdown)                                                \
+                (app_callback_ptr)->error_handler((app_callback_ptr)->handle, (uint32_t)err); \
+            return NULL;                                                                      \
+        }                                                                                     \
+    } while (0)
+
 #ifdef __cplusplus
 }
 #endif
@@ -249,8 +249,15 @@ void set_segments_numbers(SequenceControlSet* scs) {
     // We can use tile group to control the threads/parallelism in ED stage
     // NOTE:1 col will have better perf for segments for large resolutions
     //by default, do not use tile prallel. to enable, one can set one tile-group per tile.
-    scs->tile_group_col_count_array = 1;
-    scs->tile_group_row_count_array = 1;
+    // A still picture has no other pictures in flight to keep the threads busy, so give each
+    // tile its own tile group and let the tile wavefronts run concurrently.
+    if (scs->static_config.avif && lp != PARALLEL_LEVEL_1) {
+        scs->tile_group_col_count_array = 1 << scs->static_config.tile_columns;
+        scs->tile_group_row_count_array = 1 << scs->static_config.tile_rows;
+    } else {
+        scs->tile_group_col_count_array = 1;
+        scs->tile_group_row_count_array = 1;
+    }
 
     // TPL processed in 64x64 blocks, so check width against 64x64 block size (even if SB is 128x128)
     scs->tpl_segment_row_count_array = (lp == PARALLEL_LEVEL_1 ||
@@ -657,6 +664,11 @@ static EbErrorType load_default_buffer_configuration_settings(SequenceControlSet
         scs->total_process_init_count += (scs->rest_process_init_count = clamp(10, 1, max_rest_proc));
     }
 
+    // Each picture may also post one restoration helper task per extra rest process (see svt_aom_rest_kernel)
+    scs->cdef_fifo_init_count = MIN(max_fifo,
+                                    scs->picture_control_set_pool_init_count_child *
+                                        (tot_rest_segs + scs->rest_process_init_count - 1));
+
     scs->total_process_init_count += 6; // single processes count
     if (scs->static_config.pass == 0 || scs->static_config.pass == 2) {
         SVT_INFO("Level of Parallelism: %u\n", lp);
@@ -858,6 +870,28 @@ static void svt_enc_handle_stop_threads(EbEncHandle* enc_handle_ptr) {
     EB_DESTROY_THREAD(enc_handle_ptr->packetization_thread_handle);
 }
 
+// Delete the process contexts but the enc dec ones, which hold no stream state and are the costly ones to build
+static void svt_enc_handle_delete_contexts(EbEncHandle* enc_handle_ptr) {
+    SequenceControlSet* scs = enc_handle_ptr->scs_instance->scs;
+    EB_DELETE(enc_handle_ptr->resource_coordination_context_ptr);
+    EB_DELETE_PTR_ARRAY(enc_handle_ptr->picture_analysis_context_ptr_array, scs->picture_analysis_process_init_count);
+    EB_DELETE_PTR_ARRAY(enc_handle_ptr->motion_estimation_context_ptr_array, scs->motion_estimation_process_init_count);
+    EB_DELETE_PTR_ARRAY(enc_handle_ptr->tpl_disp_context_ptr_array, scs->tpl_disp_process_init_count);
+    EB_DELETE_PTR_ARRAY(enc_handle_ptr->source_based_operations_context_ptr_array,
+                        scs->source_based_operations_process_init_count);
+    EB_DELETE_PTR_ARRAY(enc_handle_ptr->mode_decision_configuration_context_ptr_array,
+                        scs->mode_decision_configuration_process_init_count);
+    EB_DELETE_PTR_ARRAY(enc_handle_ptr->dlf_context_ptr_array, scs->dlf_process_init_count);
+    EB_DELETE_PTR_ARRAY(enc_handle_ptr->cdef_context_ptr_array, scs->cdef_process_init_count);
+    EB_DELETE_PTR_ARRAY(enc_handle_ptr->rest_context_ptr_array, scs->rest_process_init_count);
+    EB_DELETE_PTR_ARRAY(enc_handle_ptr->entropy_coding_context_ptr_array, scs->entropy_coding_process_init_count);
+    EB_DELETE(enc_handle_ptr->picture_decision_context_ptr);
+    EB_DELETE(enc_handle_ptr->initial_rate_control_context_ptr);
+    EB_DELETE(enc_handle_ptr->picture_manager_context_ptr);
+    EB_DELETE(enc_handle_ptr->rate_control_context_ptr);
+    EB_DELETE(enc_handle_ptr->packetization_context_ptr);
+}
+
 /**********************************
 * Encoder Library Handle Deonstructor
 **********************************/
@@ -906,26 +940,13 @@ static void svt_enc_handle_dctor(EbPtr p) {
     EB_DELETE(enc_handle_ptr->rest_results_resource_ptr);
     EB_DELETE(enc_handle_ptr->entropy_coding_results_resource_ptr);
 
-    EB_DELETE(enc_handle_ptr->resource_coordination_context_ptr);
-    SequenceControlSet* scs = enc_handle_ptr->scs_instance->scs;
-    EB_DELETE_PTR_ARRAY(enc_handle_ptr->picture_analysis_context_ptr_array, scs->picture_analysis_process_init_count);
-    EB_DELETE_PTR_ARRAY(enc_handle_ptr->motion_estimation_context_ptr_array, scs->motion_estimation_process_init_count);
-    EB_DELETE_PTR_ARRAY(enc_handle_ptr->tpl_disp_context_ptr_array, scs->tpl_disp_process_init_count);
-    EB_DELETE_PTR_ARRAY(enc_handle_ptr->source_based_operations_context_ptr_array,
-                        scs->source_based_operations_process_init_count);
-    EB_DELETE_PTR_ARRAY(enc_handle_ptr->mode_decision_configuration_context_ptr_array,
-                        scs->mode_decision_configuration_process_init_count);
-    EB_DELETE_PTR_ARRAY(enc_handle_ptr->enc_dec_context_ptr_array, scs->enc_dec_process_init_count);
-    EB_DELETE_PTR_ARRAY(enc_handle_ptr->dlf_context_ptr_array, scs->dlf_process_init_count);
-    EB_DELETE_PTR_ARRAY(enc_handle_ptr->cdef_context_ptr_array, scs->cdef_process_init_count);
-    EB_DELETE_PTR_ARRAY(enc_handle_ptr->rest_context_ptr_array, scs->rest_process_init_count);
-    EB_DELETE_PTR_ARRAY(enc_handle_ptr->entropy_coding_context_ptr_array, scs->entropy_coding_process_init_count);
+    svt_enc_handle_delete_contexts(enc_handle_ptr);
+    EB_DELETE_PTR_ARRAY(enc_handle_ptr->enc_dec_context_ptr_array,
+                        enc_handle_ptr->scs_instance->scs->enc_dec_process_init_count);
     EB_DELETE(enc_handle_ptr->scs_instance);
-    EB_DELETE(enc_handle_ptr->picture_decision_context_ptr);
-    EB_DELETE(enc_handle_ptr->initial_rate_control_context_ptr);
-    EB_DELETE(enc_handle_ptr->picture_manager_context_ptr);
-    EB_DELETE(enc_handle_ptr->rate_control_context_ptr);
-    EB_DELETE(enc_handle_ptr->packetization_context_ptr);
+    if (enc_handle_ptr->init_scs) {
+        EB_FREE(enc_handle_ptr->init_scs);
+    }
 }
 
 /**********************************
@@ -936,8 +957,11 @@ static EbErrorType svt_enc_handle_ctor(EbEncHandle* enc_handle_ptr, EbComponentT
 
     // Initialize Callbacks
     EB_MALLOC_OBJECT(enc_handle_ptr->app_callback_ptr);
-    enc_handle_ptr->app_callback_ptr->error_handler = lib_svt_encoder_send_error_exit;
-    enc_handle_ptr->app_callback_ptr->handle        = ebHandlePtr;
+    enc_handle_ptr->app_callback_ptr->error_handler        = lib_svt_encoder_send_error_exit;
+    enc_handle_ptr->app_callback_ptr->handle               = ebHandlePtr;
+    enc_handle_ptr->app_callback_ptr->packet_ready_handler = NULL;
+    enc_handle_ptr->app_callback_ptr->packet_ready_context = NULL;
+    memset(&enc_handle_ptr->app_callback_ptr->packet_allocator, 0, sizeof(SvtAv1PacketAllocator));
 
     // Config Set Count
     enc_handle_ptr->scs_pool_total_count = EB_SequenceControlSetPoolInitCount;
@@ -948,6 +972,7 @@ static EbErrorType svt_enc_handle_ctor(EbEncHandle* enc_handle_ptr, EbComponentT
     enc_handle_ptr->eos_sent       = false;
     enc_handle_ptr->frame_received = false;
     enc_handle_ptr->is_prev_valid  = true;
+    enc_handle_ptr->fatal_error    = false;
     return EB_ErrorNone;
 }
 
@@ -1113,19 +1138,14 @@ static int create_pa_ref_buf_descs(EbEncHandle* enc_handle_ptr) {
     eb_pa_ref_obj_ect_desc_init_data_structure.sixteenth_picture_desc_init_data = sixteenth_pic_buf_desc_init_data;
     // Reference Picture Buffers
     EB_NEW(enc_handle_ptr->pa_reference_picture_pool_ptr,
-           svt_system_resource_ctor,
+           svt_system_resource_lazy_ctor,
            scs->pa_reference_picture_buffer_init_count,
            EB_PictureDecisionProcessInitCount,
            0,
            svt_pa_reference_object_creator,
            &(eb_pa_ref_obj_ect_desc_init_data_structure),
+           sizeof(eb_pa_ref_obj_ect_desc_init_data_structure),
            NULL);
-    // Set the SequenceControlSet Picture Pool Fifo Ptrs
-    enc_handle_ptr->scs_instance->enc_ctx->pa_reference_picture_pool_fifo_ptr = svt_system_resource_get_producer_fifo(
-        enc_handle_ptr->pa_reference_picture_pool_ptr, 0);
-#if SRM_REPORT
-    enc_handle_ptr->scs_instance->enc_ctx->pa_reference_picture_pool_fifo_ptr->queue_ptr->log = 0;
-#endif
     return 0;
 }
 
@@ -1155,19 +1175,14 @@ static int create_tpl_ref_buf_descs(EbEncHandle* enc_handle_ptr) {
 
     // Reference Picture Buffers
     EB_NEW(enc_handle_ptr->tpl_reference_picture_pool_ptr,
-           svt_system_resource_ctor,
+           svt_system_resource_lazy_ctor,
            scs->tpl_reference_picture_buffer_init_count,
            EB_PictureDecisionProcessInitCount,
            0,
            svt_tpl_reference_object_creator,
            &(eb_tpl_ref_obj_ect_desc_init_data_structure),
+           sizeof(eb_tpl_ref_obj_ect_desc_init_data_structure),
            NULL);
-    // Set the SequenceControlSet Picture Pool Fifo Ptrs
-    enc_handle_ptr->scs_instance->enc_ctx->tpl_reference_picture_pool_fifo_ptr = svt_system_resource_get_producer_fifo(
-        enc_handle_ptr->tpl_reference_picture_pool_ptr, 0);
-#if SRM_REPORT
-    enc_handle_ptr->scs_instance->enc_ctx->tpl_reference_picture_pool_fifo_ptr->queue_ptr->log = 0;
-#endif
     return 0;
 }
 
@@ -1204,13 +1219,37 @@ static int create_ref_buf_descs(EbEncHandle* enc_handle_ptr) {
     eb_ref_obj_ect_desc_init_data_structure.static_config                    = &scs->static_config;
     // Reference Picture Buffers
     EB_NEW(enc_handle_ptr->reference_picture_pool_ptr,
-           svt_system_resource_ctor,
+           svt_system_resource_lazy_ctor,
            scs->reference_picture_buffer_init_count,
            EB_PictureManagerProcessInitCount,
            0,
            svt_reference_object_creator,
            &(eb_ref_obj_ect_desc_init_data_structure),
+           sizeof(eb_ref_obj_ect_desc_init_data_structure),
            NULL);
+    return 0;
+}
+
+/**********************************
+* Attach the stream state of the encode context to the pipeline resources
+**********************************/
+static EbErrorType init_encode_context(EbEncHandle* enc_handle_ptr) {
+    SequenceControlSet* scs     = enc_handle_ptr->scs_instance->scs;
+    EncodeContext*      enc_ctx = enc_handle_ptr->scs_instance->enc_ctx;
+
+    // Set the SequenceControlSet Picture Pool Fifo Ptrs
+    enc_ctx->pa_reference_picture_pool_fifo_ptr = svt_system_resource_get_producer_fifo(
+        enc_handle_ptr->pa_reference_picture_pool_ptr, 0);
+#if SRM_REPORT
+    enc_ctx->pa_reference_picture_pool_fifo_ptr->queue_ptr->log = 0;
+#endif
+    if (scs->tpl) {
+        enc_ctx->tpl_reference_picture_pool_fifo_ptr = svt_system_resource_get_producer_fifo(
+            enc_handle_ptr->tpl_reference_picture_pool_ptr, 0);
+#if SRM_REPORT
+        enc_ctx->tpl_reference_picture_pool_fifo_ptr->queue_ptr->log = 0;
+#endif
+    }
 
     // Create reference list for Picture Manager
     // When decode-order is not enforced at pic mgr, each reference picture must have an allocated reference buffer (for at least one mini-gop) so the
@@ -1218,21 +1257,56 @@ static int create_ref_buf_descs(EbEncHandle* enc_handle_ptr) {
     // otherwise ref_buffer_available_semaphore will block all required pics from being passed to pic mgr.
     const uint32_t ref_pic_list_length = scs->enable_dec_order ? scs->pa_reference_picture_buffer_init_count
                                                                : scs->reference_picture_buffer_init_count;
-    enc_handle_ptr->scs_instance->enc_ctx->ref_pic_list_length = ref_pic_list_length;
-    EB_ALLOC_PTR_ARRAY(enc_handle_ptr->scs_instance->enc_ctx->ref_pic_list, ref_pic_list_length);
+    enc_ctx->ref_pic_list_length = ref_pic_list_length;
+    EB_ALLOC_PTR_ARRAY(enc_ctx->ref_pic_list, ref_pic_list_length);
 
     for (uint32_t idx = 0; idx < ref_pic_list_length; ++idx) {
-        EB_NEW(enc_handle_ptr->scs_instance->enc_ctx->ref_pic_list[idx], svt_aom_reference_queue_entry_ctor);
+        EB_NEW(enc_ctx->ref_pic_list[idx], svt_aom_reference_queue_entry_ctor);
     }
     EB_CREATE_SEMAPHORE(scs->ref_buffer_available_semaphore, ref_pic_list_length, ref_pic_list_length);
-    enc_handle_ptr->scs_instance->enc_ctx->reference_picture_pool_fifo_ptr = svt_system_resource_get_producer_fifo(
+    enc_ctx->reference_picture_pool_fifo_ptr = svt_system_resource_get_producer_fifo(
         enc_handle_ptr->reference_picture_pool_ptr, 0);
-
 #if SRM_REPORT
-    enc_handle_ptr->scs_instance->enc_ctx->reference_picture_pool_fifo_ptr->queue_ptr->log = 0;
+    enc_ctx->reference_picture_pool_fifo_ptr->queue_ptr->log = 0;
 #endif
 
-    return 0;
+    if (scs->static_config.enable_overlays) {
+        // Set the SequenceControlSet Overlay input Picture Pool Fifo Ptrs
+        enc_ctx->overlay_input_picture_pool_fifo_ptr = svt_system_resource_get_producer_fifo(
+            enc_handle_ptr->overlay_input_picture_pool_ptr, 0);
+    }
+
+    EB_ALLOC_PTR_ARRAY(enc_ctx->picture_decision_reorder_queue, enc_ctx->picture_decision_reorder_queue_size);
+    for (uint32_t picture_index = 0; picture_index < enc_ctx->picture_decision_reorder_queue_size; ++picture_index) {
+        EB_NEW(enc_ctx->picture_decision_reorder_queue[picture_index],
+               svt_aom_picture_decision_reorder_entry_ctor,
+               picture_index);
+    }
+
+    EB_ALLOC_PTR_ARRAY(enc_ctx->pic_mgr_input_pic_list, enc_ctx->pic_mgr_input_pic_list_size);
+    for (uint32_t picture_index = 0; picture_index < enc_ctx->pic_mgr_input_pic_list_size; ++picture_index) {
+        EB_NEW(enc_ctx->pic_mgr_input_pic_list[picture_index], svt_aom_input_queue_entry_ctor);
+    }
+
+    EB_ALLOC_PTR_ARRAY(enc_ctx->packetization_reorder_queue, enc_ctx->packetization_reorder_queue_size);
+    for (uint32_t picture_index = 0; picture_index < enc_ctx->packetization_reorder_queue_size; ++picture_index) {
+        EB_NEW(enc_ctx->packetization_reorder_queue[picture_index],
+               svt_aom_packetization_reorder_entry_ctor,
+               picture_index);
+    }
+
+    /************************************
+    * App Callbacks
+    ************************************/
+    enc_ctx->app_callback_ptr = enc_handle_ptr->app_callback_ptr;
+    // svt Output Buffer Fifo Ptrs
+    enc_ctx->stream_output_fifo_ptr = svt_system_resource_get_producer_fifo(
+        enc_handle_ptr->output_stream_buffer_resource_ptr, 0);
+    if (scs->static_config.recon_enabled) {
+        enc_ctx->recon_output_fifo_ptr = svt_system_resource_get_producer_fifo(
+            enc_handle_ptr->output_recon_buffer_resource_ptr, 0);
+    }
+    return EB_ErrorNone;
 }
 
 void init_fn_ptr(void);
@@ -1253,6 +1327,8 @@ static ONCE_ROUTINE(init_global_tables) {
 
 DEFINE_ONCE(global_tables_once);
 
+static EbErrorType start_pipeline(EbEncHandle* enc_handle_ptr);
+
 /**********************************
 * Initialize Encoder Library
 **********************************/
@@ -1269,6 +1345,10 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
     svt_aom_setup_rtcd_internal(scs->static_config.use_cpu_flags);
     svt_run_once(&global_tables_once, init_global_tables);
 
+    // The derived settings the pipeline is built from, svt_av1_enc_reset() checks the next stream against them
+    EB_MALLOC_OBJECT(enc_handle_ptr->init_scs);
+    memcpy(enc_handle_ptr->init_scs, scs, sizeof(*scs));
+
     // Per-instance block geometry table allocation
     EB_MALLOC_ARRAY(scs->blk_geom_mds, scs->max_block_cnt);
     svt_aom_build_blk_geom(scs->svt_aom_geom_idx, scs->blk_geom_mds);
@@ -1346,23 +1426,25 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
         input_data.allintra            = scs->allintra;
         input_data.use_flat_ipp        = scs->use_flat_ipp;
         EB_NEW(enc_handle_ptr->picture_parent_control_set_pool_ptr,
-               svt_system_resource_ctor,
+               svt_system_resource_lazy_ctor,
                scs->picture_control_set_pool_init_count, //enc_handle_ptr->pcs_pool_total_count,
                1,
                0,
                svt_aom_picture_parent_control_set_creator,
                &input_data,
+               sizeof(input_data),
                NULL);
 #if SRM_REPORT
         enc_handle_ptr->picture_parent_control_set_pool_ptr->empty_queue->log = 0;
 #endif
         EB_NEW(enc_handle_ptr->me_pool_ptr,
-               svt_system_resource_ctor,
+               svt_system_resource_lazy_ctor,
                scs->me_pool_init_count,
                1,
                0,
                svt_aom_me_creator,
                &input_data,
+               sizeof(input_data),
                NULL);
 #if SRM_REPORT
         enc_handle_ptr->me_pool_ptr->empty_queue->log = 0;
@@ -1395,7 +1477,8 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
         input_data.tile_row_count    = parent_pcs->av1_cm->tiles_info.tile_rows;
         input_data.tile_column_count = parent_pcs->av1_cm->tiles_info.tile_cols;
         input_data.is_16bit_pipeline = scs->is_16bit_pipeline;
-        input_data.av1_cm            = parent_pcs->av1_cm;
+        input_data.non_m8_pad_w      = scs->max_input_pad_right;
+        input_data.non_m8_pad_h      = scs->max_input_pad_bottom;
         input_data.enc_mode          = scs->static_config.enc_mode;
 
         input_data.input_resolution = scs->input_resolution;
@@ -1406,12 +1489,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
         input_data.allintra     = scs->allintra;
         input_data.use_flat_ipp = scs->use_flat_ipp;
         EB_NEW(enc_handle_ptr->enc_dec_pool_ptr,
-               svt_system_resource_ctor,
+               svt_system_resource_lazy_ctor,
                scs->enc_dec_pool_init_count, //EB_PictureControlSetPoolInitCountChild,
                1,
                0,
                svt_aom_recon_coef_creator,
                &input_data,
+               sizeof(input_data),
                NULL);
     }
 
@@ -1439,7 +1523,8 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
         input_data.tile_row_count    = parent_pcs->av1_cm->tiles_info.tile_rows;
         input_data.tile_column_count = parent_pcs->av1_cm->tiles_info.tile_cols;
         input_data.is_16bit_pipeline = scs->is_16bit_pipeline;
-        input_data.av1_cm            = parent_pcs->av1_cm;
+        input_data.non_m8_pad_w      = scs->max_input_pad_right;
+        input_data.non_m8_pad_h      = scs->max_input_pad_bottom;
         input_data.enc_mode          = scs->static_config.enc_mode;
         input_data.static_config     = scs->static_config;
 
@@ -1451,12 +1536,13 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
         input_data.allintra     = scs->allintra;
         input_data.use_flat_ipp = scs->use_flat_ipp;
         EB_NEW(enc_handle_ptr->picture_control_set_pool_ptr,
-               svt_system_resource_ctor,
+               svt_system_resource_lazy_ctor,
                scs->picture_control_set_pool_init_count_child, //EB_PictureControlSetPoolInitCountChild,
                1,
                0,
                svt_aom_picture_control_set_creator,
                &input_data,
+               sizeof(input_data),
                NULL);
     }
 
@@ -1499,9 +1585,6 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
                    svt_overlay_buffer_header_creator,
                    scs,
                    svt_input_buffer_header_destroyer);
-            // Set the SequenceControlSet Overlay input Picture Pool Fifo Ptrs
-            enc_handle_ptr->scs_instance->enc_ctx->overlay_input_picture_pool_fifo_ptr =
-                svt_system_resource_get_producer_fifo(enc_handle_ptr->overlay_input_picture_pool_ptr, 0);
         }
     }
     /************************************
@@ -1555,7 +1638,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
                scs->total_process_init_count, //EB_PacketizationProcessInitCount,
                1,
                svt_output_buffer_header_creator,
-               &scs->static_config,
+               enc_handle_ptr->app_callback_ptr,
                svt_output_buffer_header_destroyer);
     }
     enc_handle_ptr->output_stream_buffer_consumer_fifo_ptr = svt_system_resource_get_consumer_fifo(
@@ -1614,15 +1697,6 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
                svt_aom_picture_decision_result_creator,
                &picture_decision_result_init_data,
                NULL);
-        EB_ALLOC_PTR_ARRAY(scs->enc_ctx->picture_decision_reorder_queue,
-                           scs->enc_ctx->picture_decision_reorder_queue_size);
-
-        for (uint32_t picture_index = 0; picture_index < scs->enc_ctx->picture_decision_reorder_queue_size;
-             ++picture_index) {
-            EB_NEW(scs->enc_ctx->picture_decision_reorder_queue[picture_index],
-                   svt_aom_picture_decision_reorder_entry_ctor,
-                   picture_index);
-        }
     }
 
     // Motion Estimation Results
@@ -1662,12 +1736,6 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
                svt_aom_picture_results_creator,
                &picture_result_init_data,
                NULL);
-
-        EB_ALLOC_PTR_ARRAY(scs->enc_ctx->pic_mgr_input_pic_list, scs->enc_ctx->pic_mgr_input_pic_list_size);
-
-        for (uint32_t picture_index = 0; picture_index < scs->enc_ctx->pic_mgr_input_pic_list_size; ++picture_index) {
-            EB_NEW(scs->enc_ctx->pic_mgr_input_pic_list[picture_index], svt_aom_input_queue_entry_ctor);
-        }
     }
 
     // TPL dispenser Results
@@ -1754,7 +1822,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
         EB_NEW(enc_handle_ptr->cdef_results_resource_ptr,
                svt_system_resource_ctor,
                scs->cdef_fifo_init_count,
-               scs->cdef_process_init_count,
+               scs->cdef_process_init_count + scs->rest_process_init_count, // rest posts its helper tasks
                scs->rest_process_init_count,
                cdef_results_creator,
                &cdef_result_init_data,
@@ -1784,27 +1852,20 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
                svt_aom_entropy_coding_results_creator,
                &entropy_coding_results_init_data,
                NULL);
-        EB_ALLOC_PTR_ARRAY(scs->enc_ctx->packetization_reorder_queue, scs->enc_ctx->packetization_reorder_queue_size);
-
-        for (uint32_t picture_index = 0; picture_index < scs->enc_ctx->packetization_reorder_queue_size;
-             ++picture_index) {
-            EB_NEW(scs->enc_ctx->packetization_reorder_queue[picture_index],
-                   svt_aom_packetization_reorder_entry_ctor,
-                   picture_index);
-        }
     }
 
-    /************************************
-    * App Callbacks
-    ************************************/
-    enc_handle_ptr->scs_instance->enc_ctx->app_callback_ptr = enc_handle_ptr->app_callback_ptr;
-    // svt Output Buffer Fifo Ptrs
-    enc_handle_ptr->scs_instance->enc_ctx->stream_output_fifo_ptr = svt_system_resource_get_producer_fifo(
-        enc_handle_ptr->output_stream_buffer_resource_ptr, 0);
-    if (enc_handle_ptr->scs_instance->scs->static_config.recon_enabled) {
-        enc_handle_ptr->scs_instance->enc_ctx->recon_output_fifo_ptr = svt_system_resource_get_producer_fifo(
-            enc_handle_ptr->output_recon_buffer_resource_ptr, 0);
+    return_error = init_encode_context(enc_handle_ptr);
+    if (return_error != EB_ErrorNone) {
+        return return_error;
     }
+    return start_pipeline(enc_handle_ptr);
+}
+
+/**********************************
+* Create the process contexts and launch the threads; the enc dec contexts survive svt_av1_enc_reset()
+**********************************/
+static EbErrorType start_pipeline(EbEncHandle* enc_handle_ptr) {
+    SequenceControlSet* scs = enc_handle_ptr->scs_instance->scs;
 
     /************************************
     * Contexts
@@ -1890,13 +1951,15 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
     }
 
     // EncDec Contexts
-    EB_ALLOC_PTR_ARRAY(enc_handle_ptr->enc_dec_context_ptr_array, scs->enc_dec_process_init_count);
-    for (uint32_t process_index = 0; process_index < scs->enc_dec_process_init_count; process_index++) {
-        EB_NEW(enc_handle_ptr->enc_dec_context_ptr_array[process_index],
-               svt_aom_enc_dec_context_ctor,
-               enc_handle_ptr,
-               process_index,
-               enc_dec_port_lookup(ENCDEC_INPUT_PORT_ENCDEC, process_index));
+    if (!enc_handle_ptr->enc_dec_context_ptr_array) {
+        EB_ALLOC_PTR_ARRAY(enc_handle_ptr->enc_dec_context_ptr_array, scs->enc_dec_process_init_count);
+        for (uint32_t process_index = 0; process_index < scs->enc_dec_process_init_count; process_index++) {
+            EB_NEW(enc_handle_ptr->enc_dec_context_ptr_array[process_index],
+                   svt_aom_enc_dec_context_ctor,
+                   enc_handle_ptr,
+                   process_index,
+                   enc_dec_port_lookup(ENCDEC_INPUT_PORT_ENCDEC, process_index));
+        }
     }
 
     // Dlf Contexts
@@ -2034,7 +2097,7 @@ EB_API EbErrorType svt_av1_enc_init(EbComponentType* svt_enc_component) {
 
     svt_print_memory_usage();
 
-    return return_error;
+    return EB_ErrorNone;
 }
 
 static EbErrorType enc_drain_queue(EbComponentType* svt_enc_component) {
@@ -2063,30 +2126,63 @@ static EbErrorType enc_drain_queue(EbComponentType* svt_enc_component) {
 /**********************************
 * DeInitialize Encoder Library
 **********************************/
-EB_API EbErrorType svt_av1_enc_deinit(EbComponentType* svt_enc_component) {
-    if (!svt_enc_component || !svt_enc_component->p_component_private) {
-        return EB_ErrorBadParameter;
+// Report how many of the on-demand picture objects the encode ended up allocating: the peak pipeline footprint
+static void report_pool_usage(const EbEncHandle* handle) {
+    const EbSystemResource* pools[] = {handle->picture_parent_control_set_pool_ptr,
+                                       handle->picture_control_set_pool_ptr,
+                                       handle->me_pool_ptr,
+                                       handle->enc_dec_pool_ptr,
+                                       handle->reference_picture_pool_ptr,
+                                       handle->pa_reference_picture_pool_ptr,
+                                       handle->tpl_reference_picture_pool_ptr};
+    uint32_t                created[sizeof(pools) / sizeof(pools[0])] = {0};
+    uint32_t                total[sizeof(pools) / sizeof(pools[0])]   = {0};
+    for (size_t i = 0; i < sizeof(pools) / sizeof(pools[0]); i++) {
+        if (pools[i]) {
+            created[i] = pools[i]->object_created_count;
+            total[i]   = pools[i]->object_total_count;
+        }
     }
+    if (!total[0]) {
+        return;
+    }
+    SVT_DEBUG(
+        "SVT [memory]: peak pictures allocated (used / max): parent pcs %u / %u, pcs %u / %u, me %u / %u, "
+        "enc dec %u / %u, ref %u / %u, pa ref %u / %u, tpl ref %u / %u\n",
+        created[0],
+        total[0],
+        created[1],
+        total[1],
+        created[2],
+        total[2],
+        created[3],
+        total[3],
+        created[4],
+        total[4],
+        created[5],
+        total[5],
+        created[6],
+        total[6]);
+}
 
+// Finish the current stream: whatever the application did not retrieve is discarded
+static EbErrorType enc_finish_stream(EbComponentType* svt_enc_component, const char* caller) {
     EbEncHandle* handle = svt_enc_component->p_component_private;
 
-    if (handle->input_y8b_buffer_producer_fifo_ptr && handle->frame_received) {
+    // After an error no EOS will come out of the pipeline
+    if (handle->input_y8b_buffer_producer_fifo_ptr && handle->frame_received && !handle->fatal_error) {
         if (!handle->eos_received) {
-            SVT_ERROR("deinit called without sending EOS!\n");
+            SVT_ERROR("%s called without sending EOS!\n", caller);
             svt_av1_enc_send_picture(svt_enc_component, &(EbBufferHeaderType){.flags = EB_BUFFERFLAG_EOS});
         }
 
-        EbErrorType return_error = enc_drain_queue(svt_enc_component);
-        if (return_error != EB_ErrorNone) {
-            return return_error;
-        }
-    }
-
-    // Free per-instance block geometry table
-    if (handle->scs_instance && handle->scs_instance->scs && handle->scs_instance->scs->blk_geom_mds != NULL) {
-        EB_FREE_ARRAY(handle->scs_instance->scs->blk_geom_mds);
+        return enc_drain_queue(svt_enc_component);
     }
+    return EB_ErrorNone;
+}
 
+// Signal the processes to exit once they are done with their current task
+static void enc_shutdown_processes(EbEncHandle* handle) {
     svt_shutdown_process(handle->input_buffer_resource_ptr);
     svt_shutdown_process(handle->input_cmd_resource_ptr);
     svt_shutdown_process(handle->resource_coordination_results_resource_ptr);
@@ -2104,6 +2200,27 @@ EB_API EbErrorType svt_av1_enc_deinit(EbComponentType* svt_enc_component) {
     svt_shutdown_process(handle->dlf_results_resource_ptr);
     svt_shutdown_process(handle->cdef_results_resource_ptr);
     svt_shutdown_process(handle->rest_results_resource_ptr);
+}
+
+EB_API EbErrorType svt_av1_enc_deinit(EbComponentType* svt_enc_component) {
+    if (!svt_enc_component || !svt_enc_component->p_component_private) {
+        return EB_ErrorBadParameter;
+    }
+
+    EbEncHandle* handle       = svt_enc_component->p_component_private;
+    EbErrorType  return_error = enc_finish_stream(svt_enc_component, "deinit");
+    if (return_error != EB_ErrorNone) {
+        return return_error;
+    }
+
+    report_pool_usage(handle);
+
+    // Free per-instance block geometry table
+    if (handle->scs_instance && handle->scs_instance->scs && handle->scs_instance->scs->blk_geom_mds != NULL) {
+        EB_FREE_ARRAY(handle->scs_instance->scs->blk_geom_mds);
+    }
+
+    enc_shutdown_processes(handle);
 
     return EB_ErrorNone;
 }
@@ -4663,14 +4780,8 @@ static void copy_api_from_app(SequenceControlSet* scs, EbSvtAv1EncConfiguration*
 
 * Set Parameter
 **********************************/
-EB_API EbErrorType svt_av1_enc_set_parameter(EbComponentType*          svt_enc_component,
-                                             EbSvtAv1EncConfiguration* config_struct) {
-    if (svt_enc_component == NULL) {
-        return EB_ErrorBadParameter;
-    }
-
-    EbEncHandle*        enc_handle = (EbEncHandle*)svt_enc_component->p_component_private;
-    SequenceControlSet* scs        = enc_handle->scs_instance->scs;
+// Derive the encoder settings of a stream from the application configuration into a fresh sequence control set
+static EbErrorType derive_sequence_control_set(SequenceControlSet* scs, EbSvtAv1EncConfiguration* config_struct) {
     copy_api_from_app(scs, config_struct);
 
     EbErrorType return_error = svt_av1_verify_settings(scs);
@@ -4712,9 +4823,8 @@ EB_API EbErrorType svt_av1_enc_set_parameter(EbComponentType*          svt_enc_c
 
     set_param_based_on_input(scs);
     // Initialize the Prediction Structure Group
-    EB_NO_THROW_NEW(enc_handle->scs_instance->enc_ctx->prediction_structure_group_ptr,
-                    svt_aom_prediction_structure_group_ctor);
-    if (!enc_handle->scs_instance->enc_ctx->prediction_structure_group_ptr) {
+    EB_NO_THROW_NEW(scs->enc_ctx->prediction_structure_group_ptr, svt_aom_prediction_structure_group_ctor);
+    if (!scs->enc_ctx->prediction_structure_group_ptr) {
         return EB_ErrorInsufficientResources;
     }
     return_error = load_default_buffer_configuration_settings(scs);
@@ -4748,6 +4858,321 @@ EB_API EbErrorType svt_av1_enc_set_parameter(EbComponentType*          svt_enc_c
     return return_error;
 }
 
+EB_API EbErrorType svt_av1_enc_set_parameter(EbComponentType*          svt_enc_component,
+                                             EbSvtAv1EncConfiguration* config_struct) {
+    if (svt_enc_component == NULL) {
+        return EB_ErrorBadParameter;
+    }
+
+    EbEncHandle* enc_handle = (EbEncHandle*)svt_enc_component->p_component_private;
+    return derive_sequence_control_set(enc_handle->scs_instance->scs, config_struct);
+}
+
+// The pools, fifos and kernel contexts kept across svt_av1_enc_reset() were sized and set up from the fields below,
+// so the next stream must derive the same ones. The rest, such as the rate targets and the per-picture tool levels,
+// is read from the sequence control set handed over to the pipeline.
+static bool reset_keeps_pipeline(const SequenceControlSet* cur, const SequenceControlSet* next) {
+    const EbSvtAv1EncConfiguration* a = &cur->static_config;
+    const EbSvtAv1EncConfiguration* b = &next->static_config;
+
+    // Settings read by the pool, picture, reference and kernel context constructors
+    if (a->enc_mode != b->enc_mode || a->encoder_bit_depth != b->encoder_bit_depth ||
+        a->encoder_color_format != b->encoder_color_format || a->level_of_parallelism != b->level_of_parallelism ||
+        a->use_cpu_flags != b->use_cpu_flags || a->pass != b->pass || a->rtc != b->rtc || a->avif != b->avif ||
+        a->tune != b->tune || a->fast_decode != b->fast_decode || a->pred_structure != b->pred_structure ||
+        a->hierarchical_levels != b->hierarchical_levels || a->intra_period_length != b->intra_period_length ||
+        a->rate_control_mode != b->rate_control_mode || a->recode_loop != b->recode_loop ||
+        a->enable_overlays != b->enable_overlays || a->recon_enabled != b->recon_enabled ||
+        a->enable_restoration_filtering != b->enable_restoration_filtering || a->superres_mode != b->superres_mode ||
+        a->superres_auto_search_type != b->superres_auto_search_type || a->resize_mode != b->resize_mode ||
+        a->tile_rows != b->tile_rows || a->tile_columns != b->tile_columns ||
+        a->film_grain_denoise_strength != b->film_grain_denoise_strength ||
+        a->adaptive_film_grain != b->adaptive_film_grain || a->scene_change_detection != b->scene_change_detection ||
+        a->aq_mode != b->aq_mode || a->variance_octile != b->variance_octile || a->hbd_mds != b->hbd_mds) {
+        return false;
+    }
+
+    // Picture geometry and the derived tools the picture buffers are allocated for
+    if (cur->max_input_luma_width != next->max_input_luma_width ||
+        cur->max_input_luma_height != next->max_input_luma_height ||
+        cur->max_input_pad_right != next->max_input_pad_right ||
+        cur->max_input_pad_bottom != next->max_input_pad_bottom || cur->border != next->border ||
+        cur->input_resolution != next->input_resolution || cur->encoder_bit_depth != next->encoder_bit_depth ||
+        cur->is_16bit_pipeline != next->is_16bit_pipeline ||
+        cur->enable_hbd_mode_decision != next->enable_hbd_mode_decision ||
+        cur->super_block_size != next->super_block_size || cur->b64_size != next->b64_size ||
+        cur->sb_total_count != next->sb_total_count || cur->max_block_cnt != next->max_block_cnt ||
+        cur->svt_aom_geom_idx != next->svt_aom_geom_idx || cur->mfmv_enabled != next->mfmv_enabled ||
+        cur->tpl != next->tpl || cur->calculate_variance != next->calculate_variance ||
+        cur->allintra != next->allintra || cur->use_flat_ipp != next->use_flat_ipp ||
+        cur->use_boundaries_in_rest_search != next->use_boundaries_in_rest_search ||
+        cur->enable_dec_order != next->enable_dec_order || cur->lad_mg != next->lad_mg ||
+        cur->tpl_lad_mg != next->tpl_lad_mg || cur->scd_delay != next->scd_delay ||
+        cur->vq_ctrls.sharpness_ctrls.scene_transition != next->vq_ctrls.sharpness_ctrls.scene_transition) {
+        return false;
+    }
+    for (int i = 0; i < 3; i++) {
+        if (cur->tf_params_per_type[i].enabled != next->tf_params_per_type[i].enabled) {
+            return false;
+        }
+    }
+    const MrpCtrls* mrp_a = &cur->mrp_ctrls;
+    const MrpCtrls* mrp_b = &next->mrp_ctrls;
+    if (mrp_a->base_ref_list0_count != mrp_b->base_ref_list0_count ||
+        mrp_a->base_ref_list1_count != mrp_b->base_ref_list1_count ||
+        mrp_a->non_base_ref_list0_count != mrp_b->non_base_ref_list0_count ||
+        mrp_a->non_base_ref_list1_count != mrp_b->non_base_ref_list1_count ||
+        mrp_a->sc_base_ref_list0_count != mrp_b->sc_base_ref_list0_count ||
+        mrp_a->sc_base_ref_list1_count != mrp_b->sc_base_ref_list1_count ||
+        mrp_a->sc_non_base_ref_list0_count != mrp_b->sc_non_base_ref_list0_count ||
+        mrp_a->sc_non_base_ref_list1_count != mrp_b->sc_non_base_ref_list1_count) {
+        return false;
+    }
+
+    // Segment, pool, fifo and thread counts
+    return cur->me_segment_col_count_array == next->me_segment_col_count_array &&
+        cur->me_segment_row_count_array == next->me_segment_row_count_array &&
+        cur->enc_dec_segment_col_count_array == next->enc_dec_segment_col_count_array &&
+        cur->enc_dec_segment_row_count_array == next->enc_dec_segment_row_count_array &&
+        cur->tpl_segment_col_count_array == next->tpl_segment_col_count_array &&
+        cur->tpl_segment_row_count_array == next->tpl_segment_row_count_array &&
+        cur->cdef_segment_column_count == next->cdef_segment_column_count &&
+        cur->cdef_segment_row_count == next->cdef_segment_row_count &&
+        cur->rest_segment_column_count == next->rest_segment_column_count &&
+        cur->rest_segment_row_count == next->rest_segment_row_count &&
+        cur->tf_segment_column_count == next->tf_segment_column_count &&
+        cur->tf_segment_row_count == next->tf_segment_row_count && cur->lp == next->lp &&
+        cur->picture_control_set_pool_init_count == next->picture_control_set_pool_init_count &&
+        cur->me_pool_init_count == next->me_pool_init_count &&
+        cur->picture_control_set_pool_init_count_child == next->picture_control_set_pool_init_count_child &&
+        cur->enc_dec_pool_init_count == next->enc_dec_pool_init_count &&
+        cur->pa_reference_picture_buffer_init_count == next->pa_reference_picture_buffer_init_count &&
+        cur->tpl_reference_picture_buffer_init_count == next->tpl_reference_picture_buffer_init_count &&
+        cur->reference_picture_buffer_init_count == next->reference_picture_buffer_init_count &&
+        cur->input_buffer_fifo_init_count == next->input_buffer_fifo_init_count &&
+        cur->overlay_input_picture_buffer_init_count == next->overlay_input_picture_buffer_init_count &&
+        cur->output_stream_buffer_fifo_init_count == next->output_stream_buffer_fifo_init_count &&
+        cur->output_recon_buffer_fifo_init_count == next->output_recon_buffer_fifo_init_count &&
+        cur->resource_coordination_fifo_init_count == next->resource_coordination_fifo_init_count &&
+        cur->picture_analysis_fifo_init_count == next->picture_analysis_fifo_init_count &&
+        cur->picture_decision_fifo_init_count == next->picture_decision_fifo_init_count &&
+        cur->motion_estimation_fifo_init_count == next->motion_estimation_fifo_init_count &&
+        cur->initial_rate_control_fifo_init_count == next->initial_rate_control_fifo_init_count &&
+        cur->picture_demux_fifo_init_count == next->picture_demux_fifo_init_count &&
+        cur->tpl_disp_fifo_init_count == next->tpl_disp_fifo_init_count &&
+        cur->rate_control_tasks_fifo_init_count == next->rate_control_tasks_fifo_init_count &&
+        cur->rate_control_fifo_init_count == next->rate_control_fifo_init_count &&
+        cur->mode_decision_configuration_fifo_init_count == next->mode_decision_configuration_fifo_init_count &&
+        cur->enc_dec_fifo_init_count == next->enc_dec_fifo_init_count &&
+        cur->entropy_coding_fifo_init_count == next->entropy_coding_fifo_init_count &&
+        cur->dlf_fifo_init_count == next->dlf_fifo_init_count &&
+        cur->cdef_fifo_init_count == next->cdef_fifo_init_count &&
+        cur->rest_fifo_init_count == next->rest_fifo_init_count &&
+        cur->picture_analysis_process_init_count == next->picture_analysis_process_init_count &&
+        cur->motion_estimation_process_init_count == next->motion_estimation_process_init_count &&
+        cur->source_based_operations_process_init_count == next->source_based_operations_process_init_count &&
+        cur->mode_decision_configuration_process_init_count == next->mode_decision_configuration_process_init_count &&
+        cur->enc_dec_process_init_count == next->enc_dec_process_init_count &&
+        cur->entropy_coding_process_init_count == next->entropy_coding_process_init_count &&
+        cur->dlf_process_init_count == next->dlf_process_init_count &&
+        cur->cdef_process_init_count == next->cdef_process_init_count &&
+        cur->rest_process_init_count == next->rest_process_init_count &&
+        cur->tpl_disp_process_init_count == next->tpl_disp_process_init_count;
+}
+
+// Drop what the pooled objects cached for the finished stream. The rescaled copies of a reference are looked up by
+// picture number, and picture numbers restart with the next stream.
+static void reset_pooled_stream_state(EbEncHandle* handle) {
+    const EbSystemResource* ppcs_pool = handle->picture_parent_control_set_pool_ptr;
+    for (uint32_t i = 0; i < ppcs_pool->object_total_count; i++) {
+        PictureParentControlSet* ppcs = (PictureParentControlSet*)ppcs_pool->wrapper_ptr_pool[i]->object_ptr;
+        if (ppcs) {
+            EB_DELETE(ppcs->enhanced_downscaled_pic);
+        }
+    }
+    const EbSystemResource* ref_pool = handle->reference_picture_pool_ptr;
+    for (uint32_t i = 0; ref_pool && i < ref_pool->object_total_count; i++) {
+        EbReferenceObject* ref_obj = (EbReferenceObject*)ref_pool->wrapper_ptr_pool[i]->object_ptr;
+        if (ref_obj) {
+            memset(ref_obj->downscaled_picture_number, 0xff, sizeof(ref_obj->downscaled_picture_number));
+        }
+    }
+    const EbSystemResource* pa_ref_pool = handle->pa_reference_picture_pool_ptr;
+    for (uint32_t i = 0; pa_ref_pool && i < pa_ref_pool->object_total_count; i++) {
+        EbPaReferenceObject* pa_ref_obj = (EbPaReferenceObject*)pa_ref_pool->wrapper_ptr_pool[i]->object_ptr;
+        if (pa_ref_obj) {
+            memset(pa_ref_obj->downscaled_picture_number, 0xff, sizeof(pa_ref_obj->downscaled_picture_number));
+        }
+    }
+}
+
+// Hand the settings of the next stream over to the sequence control set the pipeline was built with
+static void move_sequence_control_set(SequenceControlSet* scs, SequenceControlSet* next) {
+    // Set up by svt_av1_enc_init()
+    struct BlockGeom* blk_geom_mds        = scs->blk_geom_mds;
+    const int32_t     rest_units_per_tile = scs->rest_units_per_tile;
+    const uint16_t    b64_total_count     = scs->b64_total_count;
+    const uint8_t     calc_hist           = scs->calc_hist;
+
+    EB_DESTROY_SEMAPHORE(scs->ref_buffer_available_semaphore);
+    // Free what the previous stream allocated
+    scs->dctor(scs);
+    *scs                     = *next;
+    scs->blk_geom_mds        = blk_geom_mds;
+    scs->rest_units_per_tile = rest_units_per_tile;
+    scs->b64_total_count     = b64_total_count;
+    scs->calc_hist           = calc_hist;
+
+    // The buffers now belong to scs
+    next->sb_geom  = NULL;
+    next->b64_geom = NULL;
+    memset(&next->static_config.frame_scale_evts, 0, sizeof(next->static_config.frame_scale_evts));
+    memset(&next->static_config.sframe_posi, 0, sizeof(next->static_config.sframe_posi));
+}
+
+// Tear the encoder down and build it again around the next stream's sequence control set,
+// keeping the component and the application callbacks
+static EbErrorType rebuild_encoder(EbComponentType* svt_enc_component, SequenceControlSet* next) {
+    EbEncHandle* handle    = (EbEncHandle*)svt_enc_component->p_component_private;
+    EbCallback   callbacks = *handle->app_callback_ptr;
+
+    EbErrorType return_error = svt_av1_enc_deinit(svt_enc_component);
+    if (return_error == EB_ErrorNone) {
+        return_error = svt_av1_enc_component_de_init(svt_enc_component);
+    }
+    if (return_error == EB_ErrorNone) {
+        return_error = init_svt_av1_encoder_handle(svt_enc_component);
+    }
+    if (return_error != EB_ErrorNone) {
+        EB_DELETE(next->enc_ctx);
+        EB_DELETE(next);
+        return return_error;
+    }
+    handle                                          = (EbEncHandle*)svt_enc_component->p_component_private;
+    handle->app_callback_ptr->packet_ready_handler = callbacks.packet_ready_handler;
+    handle->app_callback_ptr->packet_ready_context = callbacks.packet_ready_context;
+    handle->app_callback_ptr->packet_allocator     = callbacks.packet_allocator;
+
+    EbSequenceControlSetInstance* scs_instance = handle->scs_instance;
+    EB_DELETE(scs_instance->enc_ctx);
+    EB_DELETE(scs_instance->scs);
+    scs_instance->enc_ctx = next->enc_ctx;
+    scs_instance->scs     = next;
+    return svt_av1_enc_init(svt_enc_component);
+}
+
+EB_API EbErrorType svt_av1_enc_reset(EbComponentType* svt_enc_component, EbSvtAv1EncConfiguration* config_struct) {
+    if (!svt_enc_component || !svt_enc_component->p_component_private || !config_struct) {
+        return EB_ErrorBadParameter;
+    }
+    EbEncHandle* handle = (EbEncHandle*)svt_enc_component->p_component_private;
+    if (!handle->init_scs) {
+        SVT_ERROR("svt_av1_enc_reset must be called after svt_av1_enc_init\n");
+        return EB_ErrorBadParameter;
+    }
+    if (handle->fatal_error) {
+        SVT_ERROR("svt_av1_enc_reset cannot restart an encoder stopped on an error, deinit it instead\n");
+        return EB_ErrorUndefined;
+    }
+
+    // Derive the next stream first, an invalid configuration leaves the current stream untouched
+    EncodeContext*      enc_ctx;
+    SequenceControlSet* next;
+    EB_NEW(enc_ctx, svt_aom_encode_context_ctor, NULL);
+    if (svt_aom_scs_set_creator((EbPtr*)&next, NULL) != EB_ErrorNone) {
+        EB_DELETE(enc_ctx);
+        return EB_ErrorInsufficientResources;
+    }
+    next->enc_ctx            = enc_ctx;
+    EbErrorType return_error = derive_sequence_control_set(next, config_struct);
+    if (return_error == EB_ErrorNone) {
+        return_error = enc_finish_stream(svt_enc_component, "reset");
+    }
+    if (return_error == EB_ErrorNone) {
+        // The stream is over, a retry of the reset does not wait for another EOS
+        handle->frame_received = false;
+        // Every packet of the stream is out of the pipeline: the ones still taken are held by the application,
+        // which would be left with dangling packets once the pool is reset or freed
+        const uint32_t held_packets = svt_system_resource_taken_count(handle->output_stream_buffer_resource_ptr);
+        if (held_packets) {
+            SVT_ERROR("svt_av1_enc_reset called while %u output packets are not released, release them first\n",
+                      held_packets);
+            return_error = EB_ErrorBadParameter;
+        }
+    }
+    if (return_error != EB_ErrorNone) {
+        EB_DELETE(enc_ctx);
+        EB_DELETE(next);
+        return return_error;
+    }
+    if (!reset_keeps_pipeline(handle->init_scs, next)) {
+        SVT_INFO("SVT [reset]: new configuration needs a different pipeline, rebuilding the encoder\n");
+        return rebuild_encoder(svt_enc_component, next);
+    }
+    memcpy(handle->init_scs, next, sizeof(*next));
+
+    // Every picture of the finished stream is out: stop the threads and return all the objects to their pools
+    enc_shutdown_processes(handle);
+    svt_enc_handle_stop_threads(handle);
+    svt_enc_handle_delete_contexts(handle);
+    EbSystemResource* resources[] = {handle->scs_pool_ptr,
+                                     handle->picture_parent_control_set_pool_ptr,
+                                     handle->me_pool_ptr,
+                                     handle->picture_control_set_pool_ptr,
+                                     handle->enc_dec_pool_ptr,
+                                     handle->pa_reference_picture_pool_ptr,
+                                     handle->tpl_reference_picture_pool_ptr,
+                                     handle->overlay_input_picture_pool_ptr,
+                                     handle->reference_picture_pool_ptr,
+                                     handle->input_cmd_resource_ptr,
+                                     handle->input_y8b_buffer_resource_ptr,
+                                     handle->input_buffer_resource_ptr,
+                                     handle->output_stream_buffer_resource_ptr,
+                                     handle->output_recon_buffer_resource_ptr,
+                                     handle->resource_coordination_results_resource_ptr,
+                                     handle->picture_analysis_results_resource_ptr,
+                                     handle->picture_decision_results_resource_ptr,
+                                     handle->motion_estimation_results_resource_ptr,
+                                     handle->initial_rate_control_results_resource_ptr,
+                                     handle->picture_demux_results_resource_ptr,
+                                     handle->tpl_disp_res_srm,
+                                     handle->rate_control_tasks_resource_ptr,
+                                     handle->rate_control_results_resource_ptr,
+                                     handle->enc_dec_tasks_resource_ptr,
+                                     handle->enc_dec_results_resource_ptr,
+                                     handle->dlf_results_resource_ptr,
+                                     handle->cdef_results_resource_ptr,
+                                     handle->rest_results_resource_ptr,
+                                     handle->entropy_coding_results_resource_ptr};
+    for (size_t i = 0; i < sizeof(resources) / sizeof(resources[0]); i++) {
+        if (resources[i]) {
+            return_error = svt_system_resource_reset(resources[i]);
+            if (return_error != EB_ErrorNone) {
+                return return_error;
+            }
+        }
+    }
+
+    reset_pooled_stream_state(handle);
+
+    EbSequenceControlSetInstance* scs_instance = handle->scs_instance;
+    move_sequence_control_set(scs_instance->scs, next);
+    EB_DELETE(scs_instance->enc_ctx);
+    scs_instance->enc_ctx = enc_ctx;
+    EB_DELETE(next);
+
+    handle->eos_received   = false;
+    handle->eos_sent       = false;
+    handle->frame_received = false;
+    handle->is_prev_valid  = true;
+
+    return_error = init_encode_context(handle);
+    if (return_error != EB_ErrorNone) {
+        return return_error;
+    }
+    return start_pipeline(handle);
+}
+
 EB_API EbErrorType svt_av1_enc_stream_header(EbComponentType*     svt_enc_component,
                                              EbBufferHeaderType** output_stream_ptr) {
     EbErrorType return_error = EB_ErrorNone;
@@ -5299,6 +5724,11 @@ static EbErrorType validate_on_the_fly_settings(EbBufferHeaderType* input_ptr, S
                 svt_release_mutex(config_mutex);
             }
         } else if (node->node_type == RATE_CHANGE_EVENT) {
+            if (node->size != sizeof(SvtAv1RateInfo) || !node->data) {
+                input_ptr->flags = EB_BUFFERFLAG_EOS;
+                SVT_ERROR("Invalid private data of type RATE_CHANGE_EVENT\n");
+                return EB_ErrorBadParameter;
+            }
             SvtAv1RateInfo* node_data = (SvtAv1RateInfo*)node->data;
             if ((scs->static_config.target_bit_rate != node_data->target_bit_rate) &&
                 !((scs->static_config.pred_structure == LOW_DELAY) &&
@@ -5350,6 +5780,11 @@ EB_API EbErrorType svt_av1_enc_send_picture(EbComponentType* svt_enc_component,
     EbBufferHeaderType* app_hdr    = p_buffer;
     enc_handle_ptr->frame_received = true;
 
+    if (enc_handle_ptr->fatal_error) {
+        enc_handle_ptr->eos_received = 1;
+        return EB_ErrorMax;
+    }
+
     SequenceControlSet* scs = enc_handle_ptr->scs_instance->scs;
     if (scs->static_config.avif && (p_buffer->flags & EB_BUFFERFLAG_EOS) != EB_BUFFERFLAG_EOS && p_buffer->pts == 3) {
         p_buffer->flags              = EB_BUFFERFLAG_EOS;
@@ -5372,7 +5807,10 @@ EB_API EbErrorType svt_av1_enc_send_picture(EbComponentType* svt_enc_component,
 
     // Get new Luma-8b buffer & a new (Chroma-8b + Luma-Chroma-2bit) buffers; Lib will release once done.
     EbObjectWrapper* y8b_wrapper;
-    svt_get_empty_object(enc_handle_ptr->input_y8b_buffer_producer_fifo_ptr, &y8b_wrapper);
+    if (svt_get_empty_object(enc_handle_ptr->input_y8b_buffer_producer_fifo_ptr, &y8b_wrapper) != EB_ErrorNone) {
+        enc_handle_ptr->eos_received = 1;
+        return EB_ErrorMax;
+    }
     // Update the input picture definitions: resolution of the sequence
     if (validate_on_the_fly_settings(p_buffer, scs, enc_handle_ptr->scs_instance->config_mutex)) {
         return_val                   = EB_ErrorBadParameter;
@@ -5387,7 +5825,11 @@ EB_API EbErrorType svt_av1_enc_send_picture(EbComponentType* svt_enc_component,
 
     // svt_object_inc_live_count(y8b_wrapper, 1);
 
-    svt_get_empty_object(enc_handle_ptr->input_buffer_producer_fifo_ptr, &eb_wrapper_ptr);
+    if (svt_get_empty_object(enc_handle_ptr->input_buffer_producer_fifo_ptr, &eb_wrapper_ptr) != EB_ErrorNone) {
+        svt_release_object(y8b_wrapper);
+        enc_handle_ptr->eos_received = 1;
+        return EB_ErrorMax;
+    }
     // if resolution has changed, and the input_buffer settings do not match scs settings, update input_buffer settings
     if (buffer_update_needed((EbBufferHeaderType*)eb_wrapper_ptr->object_ptr, scs)) {
         svt_input_buffer_header_update((EbBufferHeaderType*)eb_wrapper_ptr->object_ptr, scs, true);
@@ -5429,7 +5871,12 @@ EB_API EbErrorType svt_av1_enc_send_picture(EbComponentType* svt_enc_component,
 
     //Take a new App-RessCoord command
     EbObjectWrapper* input_cmd_wrp;
-    svt_get_empty_object(enc_handle_ptr->input_cmd_producer_fifo_ptr, &input_cmd_wrp);
+    if (svt_get_empty_object(enc_handle_ptr->input_cmd_producer_fifo_ptr, &input_cmd_wrp) != EB_ErrorNone) {
+        svt_release_object(y8b_wrapper);
+        svt_release_object(eb_wrapper_ptr);
+        enc_handle_ptr->eos_received = 1;
+        return EB_ErrorMax;
+    }
     InputCommand* input_cmd_obj = (InputCommand*)input_cmd_wrp->object_ptr;
     //Fill the command with two picture buffers
     input_cmd_obj->eb_input_wrapper_ptr = eb_wrapper_ptr;
@@ -5511,11 +5958,94 @@ EB_API EbErrorType svt_av1_enc_get_packet(EbComponentType* svt_enc_component, Eb
     return return_error;
 }
 
+EB_API EbErrorType svt_av1_enc_set_packet_allocator(EbComponentType*             svt_enc_component,
+                                                    const SvtAv1PacketAllocator* allocator) {
+    if (svt_enc_component == NULL || svt_enc_component->p_component_private == NULL) {
+        return EB_ErrorBadParameter;
+    }
+    if (allocator && (!allocator->alloc || !allocator->free)) {
+        SVT_ERROR("svt_av1_enc_set_packet_allocator requires both alloc and free callbacks\n");
+        return EB_ErrorBadParameter;
+    }
+    EbEncHandle* enc_handle = (EbEncHandle*)svt_enc_component->p_component_private;
+    // Payloads already in flight must be freed with the allocator they came from
+    if (enc_handle->scs_instance->enc_ctx->stream_output_fifo_ptr) {
+        SVT_ERROR("svt_av1_enc_set_packet_allocator must be called before svt_av1_enc_init\n");
+        return EB_ErrorBadParameter;
+    }
+    if (allocator) {
+        enc_handle->app_callback_ptr->packet_allocator = *allocator;
+    } else {
+        memset(&enc_handle->app_callback_ptr->packet_allocator, 0, sizeof(SvtAv1PacketAllocator));
+    }
+    return EB_ErrorNone;
+}
+
+EB_API EbErrorType svt_av1_enc_set_packet_ready_callback(EbComponentType*          svt_enc_component,
+                                                         SvtAv1PacketReadyCallback callback, void* context) {
+    if (svt_enc_component == NULL || svt_enc_component->p_component_private == NULL) {
+        return EB_ErrorBadParameter;
+    }
+    EbEncHandle* enc_handle = (EbEncHandle*)svt_enc_component->p_component_private;
+    // The kernels read the callback without locking, so it can only be changed before the threads are created
+    if (enc_handle->scs_instance->enc_ctx->stream_output_fifo_ptr) {
+        SVT_ERROR("svt_av1_enc_set_packet_ready_callback must be called before svt_av1_enc_init\n");
+        return EB_ErrorBadParameter;
+    }
+    enc_handle->app_callback_ptr->packet_ready_handler = callback;
+    enc_handle->app_callback_ptr->packet_ready_context = callback ? context : NULL;
+    return EB_ErrorNone;
+}
+
+EB_API EbErrorType svt_av1_enc_update_rate_info(EbComponentType*        svt_enc_component,
+                                                const SvtAv1RateUpdate* rate_info) {
+    if (svt_enc_component == NULL || svt_enc_component->p_component_private == NULL || rate_info == NULL) {
+        return EB_ErrorBadParameter;
+    }
+    EbEncHandle* enc_handle = (EbEncHandle*)svt_enc_component->p_component_private;
+    // The settings svt_av1_enc_init() derived, they do not change while the stream is encoded
+    const SequenceControlSet* scs = enc_handle->init_scs;
+    if (!scs) {
+        SVT_ERROR("svt_av1_enc_update_rate_info must be called after svt_av1_enc_init\n");
+        return EB_ErrorBadParameter;
+    }
+    const EbSvtAv1EncConfiguration* config   = &scs->static_config;
+    const bool                      crf_mode = config->rate_control_mode == SVT_AV1_RC_MODE_CQP_OR_CRF;
+    if (rate_info->seq_qp && (!crf_mode || rate_info->seq_qp > MAX_QP_VALUE)) {
+        SVT_ERROR("QP change on the fly requires --rc 0 and a QP value less than or equal to 63\n");
+        return EB_ErrorBadParameter;
+    }
+    // VBR spreads its budget over the lookahead and the first pass statistics, which are set up for one rate
+    if (rate_info->target_bit_rate &&
+        (config->rate_control_mode != SVT_AV1_RC_MODE_CBR || rate_info->target_bit_rate > 100000000)) {
+        SVT_ERROR("TBR change on the fly requires --rc 2 and a target bit rate between [1, 100000] kbps\n");
+        return EB_ErrorBadParameter;
+    }
+    // Capping is decided when the encoder is initialized, only the cap itself can change
+    if (rate_info->max_bit_rate && (!crf_mode || !config->max_bit_rate || rate_info->max_bit_rate > 100000000)) {
+        SVT_ERROR("Max bit rate change on the fly requires capped CRF and a max bit rate between [1, 100000] kbps\n");
+        return EB_ErrorBadParameter;
+    }
+
+    // Picked up by picture decision when it sets up the next mini-GOP
+    EncodeContext* enc_ctx = enc_handle->scs_instance->enc_ctx;
+    svt_block_on_mutex(enc_ctx->rate_info_mutex);
+    if (rate_info->seq_qp) {
+        enc_ctx->rate_info.seq_qp = rate_info->seq_qp;
+    }
+    if (rate_info->target_bit_rate) {
+        enc_ctx->rate_info.target_bit_rate = rate_info->target_bit_rate;
+    }
+    if (rate_info->max_bit_rate) {
+        enc_ctx->rate_info.max_bit_rate = rate_info->max_bit_rate;
+    }
+    svt_release_mutex(enc_ctx->rate_info_mutex);
+    return EB_ErrorNone;
+}
+
 EB_API void svt_av1_enc_release_out_buffer(EbBufferHeaderType** p_buffer) {
     if (p_buffer && (*p_buffer)->wrapper_ptr) {
-        if ((*p_buffer)->p_buffer) {
-            EB_FREE((*p_buffer)->p_buffer);
-        }
+        svt_aom_free_packet_payload(*p_buffer);
         // Release out put buffer back into the pool
         svt_release_object((EbObjectWrapper*)(*p_buffer)->wrapper_ptr);
     }
@@ -5564,7 +6094,8 @@ static void lib_svt_encoder_send_error_exit(EbPtr hComponent, uint32_t error_cod
     EbObjectWrapper*    eb_wrapper_ptr    = NULL;
     EbBufferHeaderType* output_packet;
 
-    svt_get_empty_object(enc_handle->output_stream_buffer_consumer_fifo_ptr, &eb_wrapper_ptr);
+    // Empty packets come from the producer side of the output stream, as in packetization
+    svt_get_empty_object(enc_handle->scs_instance->enc_ctx->stream_output_fifo_ptr, &eb_wrapper_ptr);
 
     output_packet = (EbBufferHeaderType*)eb_wrapper_ptr->object_ptr;
 
@@ -5572,7 +6103,20 @@ static void lib_svt_encoder_send_error_exit(EbPtr hComponent, uint32_t error_cod
     output_packet->flags    = error_code;
     output_packet->p_buffer = NULL;
 
-    svt_post_full_object(eb_wrapper_ptr);
+    enc_handle->fatal_error = true;
+    svt_aom_post_output_stream(enc_handle->app_callback_ptr, eb_wrapper_ptr);
+
+    // The stopped pipeline no longer releases its pictures: wake up the application and the processes waiting on them
+    svt_shutdown_producers(enc_handle->input_y8b_buffer_resource_ptr);
+    svt_shutdown_producers(enc_handle->input_buffer_resource_ptr);
+    svt_shutdown_producers(enc_handle->input_cmd_resource_ptr);
+    svt_shutdown_producers(enc_handle->picture_parent_control_set_pool_ptr);
+    svt_shutdown_producers(enc_handle->picture_control_set_pool_ptr);
+    svt_shutdown_producers(enc_handle->me_pool_ptr);
+    svt_shutdown_producers(enc_handle->enc_dec_pool_ptr);
+    svt_shutdown_producers(enc_handle->pa_reference_picture_pool_ptr);
+    svt_shutdown_producers(enc_handle->tpl_reference_picture_pool_ptr);
+    svt_shutdown_producers(enc_handle->reference_picture_pool_ptr);
 }
 
 EB_API const char* svt_av1_get_version(void) {
@@ -5825,12 +6369,13 @@ EbErrorType svt_overlay_buffer_header_creator(EbPtr* object_dbl_ptr, EbPtr objec
 * EbBufferHeaderType Constructor
 **************************************/
 EbErrorType svt_output_buffer_header_creator(EbPtr* object_dbl_ptr, EbPtr object_init_data_ptr) {
-    (void)object_init_data_ptr;
-    EbBufferHeaderType* out_buf_ptr;
+    EbOutputStreamBuffer* out_stream_buf;
 
     *object_dbl_ptr = NULL;
-    EB_CALLOC(out_buf_ptr, 1, sizeof(EbBufferHeaderType));
-    *object_dbl_ptr = (EbPtr)out_buf_ptr;
+    EB_CALLOC(out_stream_buf, 1, sizeof(EbOutputStreamBuffer));
+    out_stream_buf->app_callback_ptr = (EbCallback*)object_init_data_ptr;
+    EbBufferHeaderType* out_buf_ptr  = &out_stream_buf->header;
+    *object_dbl_ptr                  = (EbPtr)out_buf_ptr;
 
     // Initialize Header
     out_buf_ptr->size = sizeof(EbBufferHeaderType);
@@ -120,10 +120,14 @@ struct _EbEncHandle {
     EbFifo* output_stream_buffer_consumer_fifo_ptr;
     EbFifo* output_recon_buffer_consumer_fifo_ptr;
 
+    // Sequence control set as derived from the configuration, before svt_av1_enc_init() completes it
+    SequenceControlSet* init_scs;
+
     bool eos_received; // used to signal we received the EOS from the app
     bool eos_sent; // used to signal we sent the EOS to the app
     bool frame_received; // used to signal we received any frame from the app
     bool is_prev_valid; // whether the previous input is valid or not
+    bool fatal_error; // a process reported an error through the error handler, the pipeline is stopped
 };
 
 void set_segments_numbers(SequenceControlSet* scs);
@@ -789,11 +789,16 @@ EbErrorType svt_av1_verify_settings(SequenceControlSet* scs) {
         SVT_WARN("Non-RTC M10+ are meant for automation tooling usage. Visual artifacts may occur otherwise.\n");
     }
 
-    if (scs->static_config.scene_change_detection) {
+    // Key frames at scene changes are only inserted as closed-GOP segment boundaries (e.g. for scene-aligned
+    // chunking), where the rate control does not assume a fixed key frame distance
+    if (scs->static_config.scene_change_detection &&
+        (config->intra_refresh_type != SVT_AV1_KF_REFRESH || config->pred_structure != RANDOM_ACCESS ||
+         config->rate_control_mode != SVT_AV1_RC_MODE_CQP_OR_CRF)) {
         scs->static_config.scene_change_detection = 0;
         SVT_WARN(
             "SVT-AV1 has an integrated mode decision mechanism to handle scene changes and will "
-            "not insert a key frame at scene changes\n");
+            "only insert a key frame at scene changes for closed-GOP (irefresh-type 2) random access CRF/CQP "
+            "encodes\n");
     }
     if ((config->tile_columns > 0 || config->tile_rows > 0)) {
         SVT_WARN(
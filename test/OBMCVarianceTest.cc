@@ -334,8 +334,6 @@ class CalcTargetWeightedPredTest
 
 using CalcTargetWeightedPredTestAbove = CalcTargetWeightedPredTest;
 
-GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(CalcTargetWeightedPredTestAbove);
-
 TEST_P(CalcTargetWeightedPredTestAbove, RunCheckOutput) {
     run_test();
 };
@@ -365,6 +363,13 @@ INSTANTIATE_TEST_SUITE_P(
 #endif  // ARCH_X86_64
 
 #ifdef ARCH_AARCH64
+INSTANTIATE_TEST_SUITE_P(
+    NEON, CalcTargetWeightedPredTestAbove,
+    ::testing::Combine(
+        ::testing::ValuesIn(overlap_tab),
+        ::testing::Values(svt_av1_calc_target_weighted_pred_above_c),
+        ::testing::Values(svt_av1_calc_target_weighted_pred_above_neon)));
+
 INSTANTIATE_TEST_SUITE_P(
     NEON, CalcTargetWeightedPredTestLeft,
     ::testing::Combine(
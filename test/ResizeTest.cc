@@ -16,6 +16,9 @@
  * @brief Unit test for resize of downsampling functions:
  * - svt_av1_resize_plane
  * - svt_av1_highbd_resize_plane
+ * and of the normative super-resolution upscale:
+ * - svt_av1_convolve_horiz_rs
+ * - svt_av1_highbd_convolve_horiz_rs
  *
  * @author Cidana-Edmond
  *
@@ -30,6 +33,7 @@
 #include "util.h"
 
 extern "C" void calculate_scaled_size_helper(uint16_t *dim, uint8_t denom);
+extern "C" const int16_t svt_av1_resize_filter_normative[64][8];
 
 namespace {
 using std::make_tuple;
@@ -532,4 +536,164 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Combine(::testing::ValuesIn(pic_size_vector),
                        ::testing::Range(8, 16), ::testing::Values(10, 12)));
 #endif  // CONFIG_ENABLE_HIGH_BIT_DEPTH
+
+typedef void (*ConvolveHorizRsFunc)(const uint8_t *src, int src_stride,
+                                    uint8_t *dst, int dst_stride, int w, int h,
+                                    const int16_t *x_filters, int x0_qn,
+                                    int x_step_qn);
+typedef void (*HighbdConvolveHorizRsFunc)(const uint16_t *src, int src_stride,
+                                          uint16_t *dst, int dst_stride, int w,
+                                          int h, const int16_t *x_filters,
+                                          int x0_qn, int x_step_qn, int bd);
+
+static const int rs_max_width = 1024;
+static const int rs_height = 4;
+// Source columns read on either side of the upscaled row
+static const int rs_border = 8;
+static const int rs_src_stride = rs_max_width + 2 * rs_border;
+static const int rs_dst_stride = 2 * rs_max_width;
+
+/**
+ * @brief Unit test for the normative super-resolution upscale:
+ * - svt_av1_convolve_horiz_rs
+ * - svt_av1_highbd_convolve_horiz_rs
+ *
+ * Test strategy:
+ * Upscale random and extreme rows by every denominator from 9 to 16, with
+ * random widths and start phases, and compare against the C code. The
+ * widths cover the vector loop and the scalar tail.
+ */
+template <typename Sample, typename FuncType>
+class ConvolveHorizRsTest : public ::testing::TestWithParam<FuncType> {
+  public:
+    ConvolveHorizRsTest() : rnd_(16, false) {
+    }
+
+  protected:
+    void fill(Sample *src, int bd, bool extreme) {
+        const int max = (1 << bd) - 1;
+        for (int i = 0; i < rs_src_stride * rs_height; i++) {
+            src[i] = (Sample)(extreme ? ((rnd_.random() & 1) ? max : 0)
+                                      : (rnd_.random() & max));
+        }
+    }
+
+    // Returns the upscaled width and sets the step and start position the
+    // way svt_av1_upscale_normative_rows() derives them
+    int setup_scale(int denom, int *x_step_qn, int *x0_qn) {
+        const int in_width = 16 + rnd_.random() % (rs_max_width * 8 / 16 - 16);
+        const int out_width = (in_width * denom + 4) / 8;
+        *x_step_qn = ((in_width << 14) + out_width / 2) / out_width;
+        *x0_qn = rnd_.random() & ((1 << 14) - 1);
+        return out_width;
+    }
+
+    SVTRandom rnd_;
+};
+
+class ConvolveHorizRsLbdTest
+    : public ConvolveHorizRsTest<uint8_t, ConvolveHorizRsFunc> {
+  protected:
+    void run_test(bool extreme) {
+        uint8_t src[rs_src_stride * rs_height];
+        uint8_t ref[rs_dst_stride * rs_height];
+        uint8_t tst[rs_dst_stride * rs_height];
+        for (int denom = 9; denom <= 16; denom++) {
+            for (int i = 0; i < min_test_times; i++) {
+                int x_step_qn, x0_qn;
+                const int w = setup_scale(denom, &x_step_qn, &x0_qn);
+                fill(src, 8, extreme);
+                memset(ref, REF_STUFF, sizeof(ref));
+                memset(tst, TST_STUFF, sizeof(tst));
+                svt_av1_convolve_horiz_rs_c(
+                    src + rs_border, rs_src_stride, ref, rs_dst_stride, w,
+                    rs_height, &svt_av1_resize_filter_normative[0][0], x0_qn,
+                    x_step_qn);
+                GetParam()(src + rs_border, rs_src_stride, tst, rs_dst_stride,
+                           w, rs_height, &svt_av1_resize_filter_normative[0][0],
+                           x0_qn, x_step_qn);
+                for (int y = 0; y < rs_height; y++) {
+                    ASSERT_EQ(0,
+                              memcmp(ref + y * rs_dst_stride,
+                                     tst + y * rs_dst_stride,
+                                     w))
+                        << "denom " << denom << " width " << w << " row "
+                        << y;
+                }
+            }
+        }
+    }
+};
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ConvolveHorizRsLbdTest);
+
+TEST_P(ConvolveHorizRsLbdTest, MatchTestWithRandomValue) {
+    run_test(false);
+}
+
+TEST_P(ConvolveHorizRsLbdTest, MatchTestWithExtremeValue) {
+    run_test(true);
+}
+
+class ConvolveHorizRsHbdTest
+    : public ConvolveHorizRsTest<uint16_t, HighbdConvolveHorizRsFunc> {
+  protected:
+    void run_test(int bd, bool extreme) {
+        uint16_t src[rs_src_stride * rs_height];
+        uint16_t ref[rs_dst_stride * rs_height];
+        uint16_t tst[rs_dst_stride * rs_height];
+        for (int denom = 9; denom <= 16; denom++) {
+            for (int i = 0; i < min_test_times; i++) {
+                int x_step_qn, x0_qn;
+                const int w = setup_scale(denom, &x_step_qn, &x0_qn);
+                fill(src, bd, extreme);
+                memset(ref, REF_STUFF, sizeof(ref));
+                memset(tst, TST_STUFF, sizeof(tst));
+                svt_av1_highbd_convolve_horiz_rs_c(
+                    src + rs_border, rs_src_stride, ref, rs_dst_stride, w,
+                    rs_height, &svt_av1_resize_filter_normative[0][0], x0_qn,
+                    x_step_qn, bd);
+                GetParam()(src + rs_border, rs_src_stride, tst, rs_dst_stride,
+                           w, rs_height, &svt_av1_resize_filter_normative[0][0],
+                           x0_qn, x_step_qn, bd);
+                for (int y = 0; y < rs_height; y++) {
+                    ASSERT_EQ(0,
+                              memcmp(ref + y * rs_dst_stride,
+                                     tst + y * rs_dst_stride,
+                                     w * sizeof(*ref)))
+                        << "bd " << bd << " denom " << denom << " width " << w
+                        << " row " << y;
+                }
+            }
+        }
+    }
+};
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ConvolveHorizRsHbdTest);
+
+TEST_P(ConvolveHorizRsHbdTest, MatchTestWithRandomValue) {
+    run_test(10, false);
+    run_test(12, false);
+}
+
+TEST_P(ConvolveHorizRsHbdTest, MatchTestWithExtremeValue) {
+    run_test(10, true);
+    run_test(12, true);
+}
+
+#ifdef ARCH_X86_64
+INSTANTIATE_TEST_SUITE_P(AVX2, ConvolveHorizRsLbdTest,
+                         ::testing::Values(svt_av1_convolve_horiz_rs_avx2));
+INSTANTIATE_TEST_SUITE_P(
+    AVX2, ConvolveHorizRsHbdTest,
+    ::testing::Values(svt_av1_highbd_convolve_horiz_rs_avx2));
+#endif  // ARCH_X86_64
+
+#ifdef ARCH_AARCH64
+INSTANTIATE_TEST_SUITE_P(NEON, ConvolveHorizRsLbdTest,
+                         ::testing::Values(svt_av1_convolve_horiz_rs_neon));
+INSTANTIATE_TEST_SUITE_P(
+    NEON, ConvolveHorizRsHbdTest,
+    ::testing::Values(svt_av1_highbd_convolve_horiz_rs_neon));
+#endif  // ARCH_AARCH64
 }  // namespace
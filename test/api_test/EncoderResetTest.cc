@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * https://www.aomedia.org/license/patent-license.
+ */
+
+/******************************************************************************
+ * @file EncoderResetTest.cc
+ *
+ * @brief SVT-AV1 encoder reset test
+ *
+ * Tests svt_av1_enc_reset: a stream encoded after a reset must be the same as
+ * the one a freshly created encoder produces, whether the pipeline is reused
+ * or rebuilt, and an invalid configuration must not disturb the current
+ * stream.
+ *
+ ******************************************************************************/
+
+#include "EbSvtAv1Enc.h"
+#include "gtest/gtest.h"
+#include "DummyVideoSource.h"
+#include <cstring>
+#include <vector>
+
+using svt_av1_video_source::DummyVideoSource;
+
+namespace {
+
+static constexpr int kWidth = 320;
+static constexpr int kHeight = 240;
+static constexpr int kNumFrames = 12;
+
+typedef std::vector<uint8_t> Stream;
+
+static void configure_encoder(EbSvtAv1EncConfiguration &config, int enc_mode,
+                              int qp, uint8_t kf_resize_denom) {
+    config.source_width = kWidth;
+    config.source_height = kHeight;
+    config.frame_rate_numerator = 30;
+    config.frame_rate_denominator = 1;
+    config.encoder_bit_depth = 8;
+    config.enc_mode = enc_mode;
+    config.level_of_parallelism = 2;
+    config.rate_control_mode = SVT_AV1_RC_MODE_CQP_OR_CRF;
+    config.qp = qp;
+    config.pred_structure = RANDOM_ACCESS;
+    if (kf_resize_denom) {
+        // Only the key frame is scaled, so the inter pictures predict from a
+        // rescaled copy of it
+        config.resize_mode = RESIZE_FIXED;
+        config.resize_kf_denom = kf_resize_denom;
+        config.resize_denom = 8;
+    }
+}
+
+class EncoderResetTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        ASSERT_EQ(EB_ErrorNone,
+                  video_source_.open_source(0, kNumFrames));
+    }
+
+    void TearDown() override {
+        video_source_.close_source();
+        close_encoder(handle_);
+    }
+
+    void open_encoder(EbComponentType **handle, int enc_mode, int qp) {
+        memset(&config_, 0, sizeof(config_));
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_init_handle(handle, &config_));
+        configure_encoder(config_, enc_mode, qp, kf_resize_denom_);
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_set_parameter(*handle, &config_));
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_init(*handle));
+    }
+
+    void close_encoder(EbComponentType *&handle) {
+        if (handle) {
+            svt_av1_enc_deinit(handle);
+            svt_av1_enc_deinit_handle(handle);
+            handle = nullptr;
+        }
+    }
+
+    void reset_encoder(int enc_mode, int qp) {
+        EbSvtAv1EncConfiguration config = config_;
+        configure_encoder(config, enc_mode, qp, kf_resize_denom_);
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_reset(handle_, &config));
+    }
+
+    void send_frames(EbComponentType *handle, int first, int count) {
+        EbBufferHeaderType header;
+        memset(&header, 0, sizeof(header));
+        header.size = sizeof(EbBufferHeaderType);
+        for (int i = first; i < first + count; i++) {
+            EbSvtIOFormat *frame = video_source_.get_frame_by_index(i);
+            ASSERT_NE(nullptr, frame);
+            header.p_buffer = reinterpret_cast<uint8_t *>(frame);
+            header.n_filled_len = video_source_.get_frame_size();
+            header.pts = i;
+            header.flags = 0;
+            header.pic_type = EB_AV1_INVALID_PICTURE;
+            ASSERT_EQ(EB_ErrorNone, svt_av1_enc_send_picture(handle, &header));
+        }
+    }
+
+    void finish_stream(EbComponentType *handle, Stream &stream) {
+        EbBufferHeaderType header;
+        memset(&header, 0, sizeof(header));
+        header.size = sizeof(EbBufferHeaderType);
+        header.flags = EB_BUFFERFLAG_EOS;
+        header.pic_type = EB_AV1_INVALID_PICTURE;
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_send_picture(handle, &header));
+        bool eos = false;
+        while (!eos) {
+            EbBufferHeaderType *packet = nullptr;
+            ASSERT_EQ(EB_ErrorNone, svt_av1_enc_get_packet(handle, &packet, 1));
+            eos = (packet->flags & EB_BUFFERFLAG_EOS) != 0;
+            stream.insert(stream.end(), packet->p_buffer,
+                          packet->p_buffer + packet->n_filled_len);
+            svt_av1_enc_release_out_buffer(&packet);
+        }
+    }
+
+    void encode(EbComponentType *handle, Stream &stream) {
+        send_frames(handle, 0, kNumFrames);
+        finish_stream(handle, stream);
+    }
+
+    void encode_fresh(int enc_mode, int qp, Stream &stream) {
+        EbComponentType *handle = nullptr;
+        open_encoder(&handle, enc_mode, qp);
+        encode(handle, stream);
+        close_encoder(handle);
+    }
+
+    EbComponentType *handle_ = nullptr;
+    EbSvtAv1EncConfiguration config_;
+    uint8_t kf_resize_denom_ = 0;
+    DummyVideoSource video_source_{IMG_FMT_420, kWidth, kHeight, 8};
+};
+
+/**
+ * @brief Streams after a reset match a new encoder
+ *
+ * A qp change keeps the pipeline, a preset change rebuilds it; both must
+ * produce the bitstream a new encoder with the same configuration produces.
+ */
+TEST_F(EncoderResetTest, MatchesNewEncoder) {
+    const int configs[][2] = {{12, 40}, {12, 40}, {12, 30}, {10, 30}};
+    open_encoder(&handle_, configs[0][0], configs[0][1]);
+    for (size_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++) {
+        if (i)
+            reset_encoder(configs[i][0], configs[i][1]);
+        Stream reset_stream, fresh_stream;
+        encode(handle_, reset_stream);
+        encode_fresh(configs[i][0], configs[i][1], fresh_stream);
+        EXPECT_FALSE(reset_stream.empty());
+        EXPECT_TRUE(reset_stream == fresh_stream)
+            << "stream " << i << " differs from a new encoder's";
+    }
+}
+
+/**
+ * @brief Rescaled references of the previous stream are not reused
+ *
+ * The reference pool caches rescaled copies of each reference by picture
+ * number. Picture numbers restart with the next stream, so a reset that keeps
+ * the pipeline must drop those copies.
+ */
+TEST_F(EncoderResetTest, ResizedStreamMatchesNewEncoder) {
+    kf_resize_denom_ = 16;
+    const int qps[] = {40, 30};
+    open_encoder(&handle_, 12, qps[0]);
+    for (size_t i = 0; i < sizeof(qps) / sizeof(qps[0]); i++) {
+        if (i)
+            reset_encoder(12, qps[i]);
+        Stream reset_stream, fresh_stream;
+        encode(handle_, reset_stream);
+        encode_fresh(12, qps[i], fresh_stream);
+        EXPECT_FALSE(reset_stream.empty());
+        EXPECT_TRUE(reset_stream == fresh_stream)
+            << "stream " << i << " differs from a new encoder's";
+    }
+}
+
+/**
+ * @brief Reset finishes a stream the application left open
+ *
+ * The pictures already sent are flushed and their packets dropped, the next
+ * stream starts clean.
+ */
+TEST_F(EncoderResetTest, FinishesOpenStream) {
+    open_encoder(&handle_, 12, 40);
+    send_frames(handle_, 0, kNumFrames / 2);
+    reset_encoder(12, 40);
+    Stream reset_stream, fresh_stream;
+    encode(handle_, reset_stream);
+    encode_fresh(12, 40, fresh_stream);
+    EXPECT_TRUE(reset_stream == fresh_stream);
+}
+
+/**
+ * @brief An invalid configuration is rejected up front
+ *
+ * The current stream keeps going as if the call had not been made.
+ */
+TEST_F(EncoderResetTest, InvalidConfigurationKeepsStream) {
+    open_encoder(&handle_, 12, 40);
+    send_frames(handle_, 0, kNumFrames / 2);
+    EbSvtAv1EncConfiguration config = config_;
+    config.qp = 99;
+    EXPECT_NE(EB_ErrorNone, svt_av1_enc_reset(handle_, &config));
+    send_frames(handle_, kNumFrames / 2, kNumFrames - kNumFrames / 2);
+    Stream stream, fresh_stream;
+    finish_stream(handle_, stream);
+    encode_fresh(12, 40, fresh_stream);
+    EXPECT_TRUE(stream == fresh_stream);
+}
+
+/**
+ * @brief Packets the application still holds block the reset
+ *
+ * Their wrappers would go back to the pool under the application. The reset
+ * is refused once the stream is finished, and goes through after the packet
+ * is released.
+ */
+TEST_F(EncoderResetTest, HeldPacketRejected) {
+    open_encoder(&handle_, 12, 40);
+    send_frames(handle_, 0, kNumFrames);
+    EbBufferHeaderType header;
+    memset(&header, 0, sizeof(header));
+    header.size = sizeof(EbBufferHeaderType);
+    header.flags = EB_BUFFERFLAG_EOS;
+    header.pic_type = EB_AV1_INVALID_PICTURE;
+    ASSERT_EQ(EB_ErrorNone, svt_av1_enc_send_picture(handle_, &header));
+    EbBufferHeaderType *packet = nullptr;
+    ASSERT_EQ(EB_ErrorNone, svt_av1_enc_get_packet(handle_, &packet, 1));
+
+    EbSvtAv1EncConfiguration config = config_;
+    configure_encoder(config, 12, 40, kf_resize_denom_);
+    EXPECT_EQ(EB_ErrorBadParameter, svt_av1_enc_reset(handle_, &config));
+    svt_av1_enc_release_out_buffer(&packet);
+    reset_encoder(12, 40);
+
+    Stream reset_stream, fresh_stream;
+    encode(handle_, reset_stream);
+    encode_fresh(12, 40, fresh_stream);
+    EXPECT_TRUE(reset_stream == fresh_stream);
+}
+
+}  // namespace
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * https://www.aomedia.org/license/patent-license.
+ */
+
+/******************************************************************************
+ * @file OutputPacketTest.cc
+ *
+ * @brief SVT-AV1 output packet delivery test
+ *
+ * Tests the application-facing output path: packets fetched after the
+ * packet-ready callback signals them, and packet payloads written into
+ * memory owned by an application allocator.
+ *
+ ******************************************************************************/
+
+#include "EbSvtAv1Enc.h"
+#include "gtest/gtest.h"
+#include "DummyVideoSource.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <set>
+
+using svt_av1_video_source::DummyVideoSource;
+
+namespace {
+
+static constexpr int kWidth = 320;
+static constexpr int kHeight = 240;
+static constexpr int kNumFrames = 20;
+static constexpr int kTimeoutSeconds = 60;
+
+// Counts packet-ready events and wakes up the consumer, like an eventfd would
+struct PacketEvents {
+    std::mutex mutex;
+    std::condition_variable cond;
+    int signalled = 0;
+};
+
+static void packet_ready(void *context) {
+    PacketEvents *events = static_cast<PacketEvents *>(context);
+    std::lock_guard<std::mutex> lock(events->mutex);
+    events->signalled++;
+    events->cond.notify_one();
+}
+
+// Tracks every payload handed out to the encoder
+struct CountingAllocator {
+    std::mutex mutex;
+    std::set<void *> live;
+    int allocs = 0;
+    int frees = 0;
+    int foreign_frees = 0;
+};
+
+static void *counting_alloc(void *context, size_t size) {
+    CountingAllocator *allocator = static_cast<CountingAllocator *>(context);
+    void *buffer = malloc(size);
+    if (buffer) {
+        std::lock_guard<std::mutex> lock(allocator->mutex);
+        allocator->live.insert(buffer);
+        allocator->allocs++;
+    }
+    return buffer;
+}
+
+static void counting_free(void *context, void *buffer) {
+    CountingAllocator *allocator = static_cast<CountingAllocator *>(context);
+    {
+        std::lock_guard<std::mutex> lock(allocator->mutex);
+        if (allocator->live.erase(buffer) == 0)
+            allocator->foreign_frees++;
+        allocator->frees++;
+    }
+    free(buffer);
+}
+
+// Fails the allocation number fail_at, serves the others from the heap
+struct FailingAllocator {
+    std::mutex mutex;
+    int allocs = 0;
+    int fail_at = 0;
+};
+
+static void *failing_alloc(void *context, size_t size) {
+    FailingAllocator *allocator = static_cast<FailingAllocator *>(context);
+    std::lock_guard<std::mutex> lock(allocator->mutex);
+    if (++allocator->allocs == allocator->fail_at)
+        return nullptr;
+    return malloc(size);
+}
+
+static void failing_free(void *, void *buffer) {
+    free(buffer);
+}
+
+static void configure_encoder(EbSvtAv1EncConfiguration &config) {
+    config.source_width = kWidth;
+    config.source_height = kHeight;
+    config.frame_rate_numerator = 30;
+    config.frame_rate_denominator = 1;
+    config.encoder_bit_depth = 8;
+    config.enc_mode = 12;
+    config.level_of_parallelism = 1;
+    config.rate_control_mode = SVT_AV1_RC_MODE_CQP_OR_CRF;
+    config.qp = 40;
+    config.pred_structure = RANDOM_ACCESS;
+}
+
+class OutputPacketTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        memset(&config_, 0, sizeof(config_));
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_init_handle(&handle_, &config_));
+        configure_encoder(config_);
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_set_parameter(handle_, &config_));
+        ASSERT_EQ(EB_ErrorNone,
+                  video_source_.open_source(0, kNumFrames));
+    }
+
+    void TearDown() override {
+        video_source_.close_source();
+        if (handle_) {
+            if (initialized_) {
+                svt_av1_enc_deinit(handle_);
+            }
+            svt_av1_enc_deinit_handle(handle_);
+        }
+    }
+
+    void send_all_frames() {
+        EbBufferHeaderType header;
+        memset(&header, 0, sizeof(header));
+        header.size = sizeof(EbBufferHeaderType);
+        for (int i = 0; i < kNumFrames; i++) {
+            EbSvtIOFormat *frame = video_source_.get_next_frame();
+            ASSERT_NE(nullptr, frame);
+            header.p_buffer = reinterpret_cast<uint8_t *>(frame);
+            header.n_filled_len = video_source_.get_frame_size();
+            header.pts = i;
+            header.flags = 0;
+            header.pic_type = EB_AV1_INVALID_PICTURE;
+            ASSERT_EQ(EB_ErrorNone, svt_av1_enc_send_picture(handle_, &header));
+        }
+        memset(&header, 0, sizeof(header));
+        header.size = sizeof(EbBufferHeaderType);
+        header.flags = EB_BUFFERFLAG_EOS;
+        header.pic_type = EB_AV1_INVALID_PICTURE;
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_send_picture(handle_, &header));
+    }
+
+    EbComponentType *handle_ = nullptr;
+    EbSvtAv1EncConfiguration config_;
+    DummyVideoSource video_source_{IMG_FMT_420, kWidth, kHeight, 8};
+    bool initialized_ = false;
+};
+
+/**
+ * @brief Packets are drained only on packet-ready events
+ *
+ * Every packet returned by svt_av1_enc_get_packet, including the EOS one,
+ * must have been announced by exactly one callback invocation, so a consumer
+ * never needs to poll.
+ */
+TEST_F(OutputPacketTest, PacketReadyCallbackDrivesDrain) {
+    PacketEvents events;
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_set_packet_ready_callback(
+                  handle_, packet_ready, &events));
+    ASSERT_EQ(EB_ErrorNone, svt_av1_enc_init(handle_));
+    initialized_ = true;
+    // The callback cannot be changed once the encoder threads are running
+    EXPECT_EQ(EB_ErrorBadParameter,
+              svt_av1_enc_set_packet_ready_callback(handle_, nullptr, nullptr));
+
+    send_all_frames();
+
+    int drained = 0;
+    bool eos = false;
+    auto deadline = std::chrono::steady_clock::now() +
+                    std::chrono::seconds(kTimeoutSeconds);
+    while (!eos) {
+        {
+            std::unique_lock<std::mutex> lock(events.mutex);
+            ASSERT_TRUE(events.cond.wait_until(lock, deadline, [&] {
+                return events.signalled > drained;
+            })) << "timed out waiting for a packet-ready event";
+        }
+        EbBufferHeaderType *packet = nullptr;
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_get_packet(handle_, &packet, 0))
+            << "a signalled packet must be available without blocking";
+        ASSERT_NE(nullptr, packet);
+        eos = (packet->flags & EB_BUFFERFLAG_EOS) != 0;
+        svt_av1_enc_release_out_buffer(&packet);
+        drained++;
+    }
+
+    std::lock_guard<std::mutex> lock(events.mutex);
+    EXPECT_EQ(events.signalled, drained);
+}
+
+/**
+ * @brief Packet payloads come from the registered allocator
+ *
+ * Every non-empty packet must point into a buffer returned by the
+ * application allocator, and every allocation must be handed back to it once
+ * the packets are released and the encoder is torn down.
+ */
+TEST_F(OutputPacketTest, PacketAllocatorOwnsPayloads) {
+    CountingAllocator counter;
+    SvtAv1PacketAllocator allocator = {counting_alloc, counting_free, &counter};
+    SvtAv1PacketAllocator incomplete = {counting_alloc, nullptr, &counter};
+    EXPECT_EQ(EB_ErrorBadParameter,
+              svt_av1_enc_set_packet_allocator(handle_, &incomplete));
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_set_packet_allocator(handle_, &allocator));
+    ASSERT_EQ(EB_ErrorNone, svt_av1_enc_init(handle_));
+    initialized_ = true;
+    // The allocator cannot be swapped while payloads may be in flight
+    EXPECT_EQ(EB_ErrorBadParameter,
+              svt_av1_enc_set_packet_allocator(handle_, nullptr));
+
+    send_all_frames();
+
+    int packets = 0;
+    bool eos = false;
+    while (!eos) {
+        EbBufferHeaderType *packet = nullptr;
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_get_packet(handle_, &packet, 1));
+        ASSERT_NE(nullptr, packet);
+        eos = (packet->flags & EB_BUFFERFLAG_EOS) != 0;
+        if (packet->n_filled_len) {
+            std::lock_guard<std::mutex> lock(counter.mutex);
+            EXPECT_EQ(1u, counter.live.count(packet->p_buffer))
+                << "packet payload was not allocated by the application";
+            packets++;
+        }
+        svt_av1_enc_release_out_buffer(&packet);
+    }
+    EXPECT_GT(packets, 0);
+
+    ASSERT_EQ(EB_ErrorNone, svt_av1_enc_deinit(handle_));
+    initialized_ = false;
+    EXPECT_GE(counter.allocs, packets);
+    EXPECT_EQ(counter.allocs, counter.frees);
+    EXPECT_EQ(0, counter.foreign_frees);
+    EXPECT_TRUE(counter.live.empty());
+}
+
+/**
+ * @brief A failed payload allocation is reported to the application
+ *
+ * The packets carrying the picture that could not be stored must make
+ * svt_av1_enc_get_packet fail, and the stream must still reach its EOS.
+ */
+TEST_F(OutputPacketTest, FailedAllocationIsReported) {
+    FailingAllocator failing;
+    failing.fail_at = 3;
+    SvtAv1PacketAllocator allocator = {failing_alloc, failing_free, &failing};
+    ASSERT_EQ(EB_ErrorNone,
+              svt_av1_enc_set_packet_allocator(handle_, &allocator));
+    ASSERT_EQ(EB_ErrorNone, svt_av1_enc_init(handle_));
+    initialized_ = true;
+
+    send_all_frames();
+
+    int errors = 0;
+    bool eos = false;
+    while (!eos) {
+        EbBufferHeaderType *packet = nullptr;
+        const EbErrorType ret = svt_av1_enc_get_packet(handle_, &packet, 1);
+        ASSERT_NE(nullptr, packet);
+        if (ret != EB_ErrorNone) {
+            EXPECT_NE(0u, packet->flags & EB_BUFFERFLAG_ERROR_MASK);
+            errors++;
+        }
+        eos = (packet->flags & EB_BUFFERFLAG_EOS) != 0;
+        svt_av1_enc_release_out_buffer(&packet);
+    }
+    // a lost hidden picture also fails the packet that shows it
+    EXPECT_GT(errors, 0);
+}
+
+}  // namespace
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * https://www.aomedia.org/license/patent-license.
+ */
+
+/******************************************************************************
+ * @file RateUpdateTest.cc
+ *
+ * @brief SVT-AV1 rate update test
+ *
+ * Tests svt_av1_enc_update_rate_info: target bit rate changes of a CBR
+ * stream must keep it within its VBV buffer and follow the new rate, requests
+ * must be accepted from another thread while encoding, and changes the rate
+ * control mode cannot apply must be rejected.
+ *
+ ******************************************************************************/
+
+#include "EbSvtAv1Enc.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+static constexpr int kWidth = 320;
+static constexpr int kHeight = 240;
+static constexpr int kFps = 30;
+static constexpr int kBufferMs = 1000;
+static constexpr int kStartMs = 600;
+
+// Moving gradient with noise, so that the rate control has to work for its
+// target
+class NoisySource {
+  public:
+    NoisySource() : luma_(kWidth * kHeight), chroma_(kWidth * kHeight / 2) {
+        memset(&frame_, 0, sizeof(frame_));
+        frame_.luma = luma_.data();
+        frame_.cb = chroma_.data();
+        frame_.cr = chroma_.data() + kWidth * kHeight / 4;
+        frame_.y_stride = kWidth;
+        frame_.cb_stride = kWidth / 2;
+        frame_.cr_stride = kWidth / 2;
+    }
+
+    EbSvtIOFormat *frame(int index) {
+        uint32_t seed = 0x9e3779b9u * (index + 1);
+        for (int y = 0; y < kHeight; y++) {
+            for (int x = 0; x < kWidth; x++) {
+                seed = seed * 1664525u + 1013904223u;
+                luma_[y * kWidth + x] = (uint8_t)(((x + 2 * index) ^ y) +
+                                                  (seed >> 28));
+            }
+        }
+        for (size_t i = 0; i < chroma_.size(); i++)
+            chroma_[i] = (uint8_t)(128 + ((i + index) & 15));
+        return &frame_;
+    }
+
+    uint32_t frame_size() const {
+        return (uint32_t)(luma_.size() + chroma_.size());
+    }
+
+  private:
+    std::vector<uint8_t> luma_;
+    std::vector<uint8_t> chroma_;
+    EbSvtIOFormat frame_;
+};
+
+// Decoder side leaky bucket: filled at the current rate, drained by each
+// frame, its fullness must never go negative
+class VbvModel {
+  public:
+    explicit VbvModel(uint32_t rate) {
+        set_rate(rate);
+        level_ = (double)rate * kStartMs / 1000;
+    }
+
+    void set_rate(uint32_t rate) {
+        rate_ = rate;
+        size_ = (double)rate * kBufferMs / 1000;
+        if (level_ > size_)
+            level_ = size_;
+    }
+
+    // Returns false on underflow
+    bool add_frame(uint32_t bytes) {
+        level_ = std::min(level_ + (double)rate_ / kFps, size_);
+        level_ -= 8.0 * bytes;
+        return level_ >= 0;
+    }
+
+    double level() const {
+        return level_;
+    }
+
+  private:
+    uint32_t rate_;
+    double size_;
+    double level_ = 0;
+};
+
+static void configure_cbr(EbSvtAv1EncConfiguration &config, uint32_t rate) {
+    config.source_width = kWidth;
+    config.source_height = kHeight;
+    config.frame_rate_numerator = kFps;
+    config.frame_rate_denominator = 1;
+    config.encoder_bit_depth = 8;
+    config.enc_mode = 10;
+    config.level_of_parallelism = 1;
+    config.pred_structure = LOW_DELAY;
+    config.rate_control_mode = SVT_AV1_RC_MODE_CBR;
+    config.target_bit_rate = rate;
+    config.maximum_buffer_size_ms = kBufferMs;
+    config.starting_buffer_level_ms = kStartMs;
+    config.optimal_buffer_level_ms = kStartMs;
+}
+
+class RateUpdateTest : public ::testing::Test {
+  protected:
+    void TearDown() override {
+        if (handle_) {
+            svt_av1_enc_deinit(handle_);
+            svt_av1_enc_deinit_handle(handle_);
+        }
+    }
+
+    void open_encoder(void (*configure)(EbSvtAv1EncConfiguration &,
+                                        uint32_t),
+                      uint32_t rate) {
+        EbSvtAv1EncConfiguration config;
+        memset(&config, 0, sizeof(config));
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_init_handle(&handle_, &config));
+        configure(config, rate);
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_set_parameter(handle_, &config));
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_init(handle_));
+    }
+
+    void send_frame(int index) {
+        EbBufferHeaderType header;
+        memset(&header, 0, sizeof(header));
+        header.size = sizeof(EbBufferHeaderType);
+        header.p_buffer = reinterpret_cast<uint8_t *>(source_.frame(index));
+        header.n_filled_len = source_.frame_size();
+        header.pts = index;
+        header.pic_type = EB_AV1_INVALID_PICTURE;
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_send_picture(handle_, &header));
+    }
+
+    void send_eos() {
+        EbBufferHeaderType header;
+        memset(&header, 0, sizeof(header));
+        header.size = sizeof(EbBufferHeaderType);
+        header.flags = EB_BUFFERFLAG_EOS;
+        header.pic_type = EB_AV1_INVALID_PICTURE;
+        ASSERT_EQ(EB_ErrorNone, svt_av1_enc_send_picture(handle_, &header));
+    }
+
+    // Size of the next frame packet, -1 once EOS is reached
+    int64_t next_frame_bytes() {
+        for (;;) {
+            EbBufferHeaderType *packet = nullptr;
+            if (svt_av1_enc_get_packet(handle_, &packet, 1) != EB_ErrorNone)
+                return -1;
+            const bool eos = (packet->flags & EB_BUFFERFLAG_EOS) != 0;
+            const int64_t bytes = packet->n_filled_len;
+            svt_av1_enc_release_out_buffer(&packet);
+            if (bytes || !eos)
+                return bytes;
+            return -1;
+        }
+    }
+
+    EbComponentType *handle_ = nullptr;
+    NoisySource source_;
+};
+
+/**
+ * @brief CBR stays within its VBV buffer across rate changes
+ *
+ * In low delay each packet is out before the next picture is sent, so every
+ * change applies from the next picture on. The decoder buffer is modeled at
+ * the rate in effect, and the rate of the second half of each segment must be
+ * close to its target.
+ */
+TEST_F(RateUpdateTest, CbrStaysWithinVbv) {
+    const uint32_t rates[] = {600000, 200000, 900000, 300000};
+    const int kSegmentFrames = 2 * kFps;
+    open_encoder(configure_cbr, rates[0]);
+    VbvModel vbv(rates[0]);
+    int frame = 0;
+    for (size_t segment = 0; segment < sizeof(rates) / sizeof(rates[0]);
+         segment++) {
+        if (segment) {
+            SvtAv1RateUpdate rate_info;
+            memset(&rate_info, 0, sizeof(rate_info));
+            rate_info.target_bit_rate = rates[segment];
+            ASSERT_EQ(EB_ErrorNone,
+                      svt_av1_enc_update_rate_info(handle_, &rate_info));
+            vbv.set_rate(rates[segment]);
+        }
+        int64_t settled_bits = 0;
+        for (int i = 0; i < kSegmentFrames; i++, frame++) {
+            send_frame(frame);
+            const int64_t bytes = next_frame_bytes();
+            ASSERT_GT(bytes, 0);
+            EXPECT_TRUE(vbv.add_frame((uint32_t)bytes))
+                << "VBV underflow at frame " << frame << " ("
+                << vbv.level() << " bits)";
+            if (i >= kSegmentFrames / 2)
+                settled_bits += 8 * bytes;
+        }
+        const double rate =
+            (double)settled_bits * kFps / (kSegmentFrames / 2);
+        EXPECT_LT(rate, 1.15 * rates[segment]) << "segment " << segment;
+        EXPECT_GT(rate, 0.75 * rates[segment]) << "segment " << segment;
+    }
+    send_eos();
+    EXPECT_EQ(-1, next_frame_bytes());
+}
+
+/**
+ * @brief Requests can come from a controller thread
+ *
+ * A thread keeps switching the target while the stream is encoded; every
+ * request must be accepted and the stream must complete.
+ */
+TEST_F(RateUpdateTest, UpdatesFromAnotherThread) {
+    const int kFrames = 2 * kFps;
+    open_encoder(configure_cbr, 500000);
+    std::atomic<bool> done(false);
+    std::atomic<int> failures(0);
+    std::thread controller([&] {
+        for (uint32_t i = 0; !done; i++) {
+            SvtAv1RateUpdate rate_info;
+            memset(&rate_info, 0, sizeof(rate_info));
+            rate_info.target_bit_rate = (i & 1) ? 250000 : 750000;
+            if (svt_av1_enc_update_rate_info(handle_, &rate_info) !=
+                EB_ErrorNone)
+                failures++;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    });
+    int frames = 0;
+    for (int i = 0; i < kFrames; i++) {
+        send_frame(i);
+        if (next_frame_bytes() > 0)
+            frames++;
+    }
+    done = true;
+    controller.join();
+    send_eos();
+    EXPECT_EQ(-1, next_frame_bytes());
+    EXPECT_EQ(kFrames, frames);
+    EXPECT_EQ(0, failures);
+}
+
+static void configure_crf(EbSvtAv1EncConfiguration &config, uint32_t) {
+    const uint32_t default_rate = config.target_bit_rate;
+    configure_cbr(config, default_rate);
+    config.pred_structure = RANDOM_ACCESS;
+    config.rate_control_mode = SVT_AV1_RC_MODE_CQP_OR_CRF;
+    config.qp = 35;
+}
+
+/**
+ * @brief Changes the rate control mode cannot follow are rejected
+ *
+ * CRF takes a new qp but no target bit rate, and no max bit rate unless it is
+ * capped.
+ */
+TEST_F(RateUpdateTest, RejectsUnsupportedChanges) {
+    SvtAv1RateUpdate rate_info;
+    memset(&rate_info, 0, sizeof(rate_info));
+    EXPECT_EQ(EB_ErrorBadParameter,
+              svt_av1_enc_update_rate_info(nullptr, &rate_info));
+
+    open_encoder(configure_crf, 0);
+    EXPECT_EQ(EB_ErrorBadParameter,
+              svt_av1_enc_update_rate_info(handle_, nullptr));
+    rate_info.seq_qp = 64;
+    EXPECT_EQ(EB_ErrorBadParameter,
+              svt_av1_enc_update_rate_info(handle_, &rate_info));
+    rate_info.seq_qp = 0;
+    rate_info.target_bit_rate = 1000000;
+    EXPECT_EQ(EB_ErrorBadParameter,
+              svt_av1_enc_update_rate_info(handle_, &rate_info));
+    rate_info.target_bit_rate = 0;
+    rate_info.max_bit_rate = 1000000;
+    EXPECT_EQ(EB_ErrorBadParameter,
+              svt_av1_enc_update_rate_info(handle_, &rate_info));
+    rate_info.max_bit_rate = 0;
+    rate_info.seq_qp = 45;
+    EXPECT_EQ(EB_ErrorNone,
+              svt_av1_enc_update_rate_info(handle_, &rate_info));
+}
+
+static void configure_crf_low_delay(EbSvtAv1EncConfiguration &config,
+                                    uint32_t) {
+    configure_crf(config, 0);
+    config.pred_structure = LOW_DELAY;
+}
+
+/**
+ * @brief A new CRF qp applies to the following pictures
+ *
+ * The qp goes through a new sequence control set, as with RATE_CHANGE_EVENT.
+ * In low delay the request is taken by the next picture sent, and a much
+ * higher qp must shrink the frames that follow.
+ */
+TEST_F(RateUpdateTest, CrfQpChangeApplies) {
+    const int kSegmentFrames = kFps;
+    open_encoder(configure_crf_low_delay, 0);
+    int64_t segment_bytes[2] = {0, 0};
+    int frame = 0;
+    for (int segment = 0; segment < 2; segment++) {
+        if (segment) {
+            SvtAv1RateUpdate rate_info;
+            memset(&rate_info, 0, sizeof(rate_info));
+            rate_info.seq_qp = 60;
+            ASSERT_EQ(EB_ErrorNone,
+                      svt_av1_enc_update_rate_info(handle_, &rate_info));
+        }
+        for (int i = 0; i < kSegmentFrames; i++, frame++) {
+            send_frame(frame);
+            const int64_t bytes = next_frame_bytes();
+            ASSERT_GT(bytes, 0);
+            // skip the key frame
+            if (frame)
+                segment_bytes[segment] += bytes;
+        }
+    }
+    send_eos();
+    EXPECT_EQ(-1, next_frame_bytes());
+    EXPECT_LT(2 * segment_bytes[1], segment_bytes[0]);
+}
+
+}  // namespace
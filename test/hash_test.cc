@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026, Alliance for Open Media. All rights reserved
+ *
+ * This source code is subject to the terms of the BSD 2 Clause License and
+ * the Alliance for Open Media Patent License 1.0. If the BSD 2 Clause License
+ * was not distributed with this source code in the LICENSE file, you can
+ * obtain it at https://www.aomedia.org/license/software-license. If the
+ * Alliance for Open Media Patent License 1.0 was not distributed with this
+ * source code in the PATENTS file, you can obtain it at
+ * https://www.aomedia.org/license/patent-license.
+ */
+
+/******************************************************************************
+ * @file hash_test.cc
+ *
+ * @brief Unit test for the CRC-32C functions used by the IntraBC hash:
+ * - svt_av1_get_crc32c_value_sse4_2
+ * - svt_av1_get_crc32c_value_arm_crc32
+ *
+ ******************************************************************************/
+
+#include "gtest/gtest.h"
+#include "aom_dsp_rtcd.h"
+#include "hash.h"
+#include "random.h"
+
+namespace {
+
+using svt_av1_test_tool::SVTRandom;
+
+typedef uint32_t (*get_crc32c_value_func)(void *crc_calculator,
+                                          const uint8_t *p, size_t length);
+
+static const size_t kMaxLength = 256;
+
+class Crc32cTest : public ::testing::TestWithParam<get_crc32c_value_func> {
+  public:
+    Crc32cTest() : test_func_(GetParam()), rnd_(8, false) {
+    }
+
+    void SetUp() override {
+        svt_av1_crc32c_calculator_init(&calc_);
+    }
+
+  protected:
+    // Check every length and start alignment, so the unaligned head, word
+    // loop and tail of the implementations are all exercised
+    void run_test() {
+        for (size_t i = 0; i < sizeof(buf_); i++) {
+            buf_[i] = (uint8_t)rnd_.random();
+        }
+        for (size_t offset = 0; offset < 8; offset++) {
+            for (size_t length = 0; length <= kMaxLength; length++) {
+                const uint8_t *p = buf_ + offset;
+                const uint32_t ref =
+                    svt_av1_get_crc32c_value_c(&calc_, p, length);
+                const uint32_t tst = test_func_(&calc_, p, length);
+                ASSERT_EQ(ref, tst)
+                    << "offset " << offset << " length " << length;
+            }
+        }
+    }
+
+    // The CRC-32C check value of "123456789" from RFC 3720
+    void run_check_value() {
+        const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+        EXPECT_EQ(0xE3069283u, test_func_(&calc_, check, sizeof(check)));
+    }
+
+    get_crc32c_value_func test_func_;
+    SVTRandom rnd_;
+    CRC32C calc_;
+    uint8_t buf_[kMaxLength + 8];
+};
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Crc32cTest);
+
+TEST_P(Crc32cTest, MatchTest) {
+    run_test();
+}
+
+TEST_P(Crc32cTest, CheckValue) {
+    run_check_value();
+}
+
+INSTANTIATE_TEST_SUITE_P(C, Crc32cTest,
+                         ::testing::Values(svt_av1_get_crc32c_value_c));
+
+#ifdef ARCH_X86_64
+INSTANTIATE_TEST_SUITE_P(SSE4_2, Crc32cTest,
+                         ::testing::Values(svt_av1_get_crc32c_value_sse4_2));
+#endif  // ARCH_X86_64
+
+#if defined(ARCH_AARCH64) && HAVE_ARM_CRC32
+INSTANTIATE_TEST_SUITE_P(ARM_CRC32, Crc32cTest,
+                         ::testing::Values(svt_av1_get_crc32c_value_arm_crc32));
+#endif  // ARCH_AARCH64 && HAVE_ARM_CRC32
+
+}  // namespace